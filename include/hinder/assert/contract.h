@@ -0,0 +1,246 @@
+#pragma once
+
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+//
+// Contract checks (HINDER_EXPECTS, HINDER_ENSURES, HINDER_INVARIANT, HINDER_ASSERT) with a
+// handler policy and checking level chosen at compile time.
+//
+// Both are selected per translation unit: define the macros before the first hinder include
+// (or pass them with -D). Like NDEBUG for assert(), an inline function that runs a check must see
+// the same settings in every translation unit that defines it.
+//
+// Handler (HINDER_CONTRACT_HANDLER), what a failed check does:
+//   HINDER_CONTRACT_HANDLER_THROW     throw the named exception (throw_assert_handler).
+//                                     Default when exceptions are enabled.
+//   HINDER_CONTRACT_HANDLER_ABORT     log to stderr and abort (abort_assert_handler).
+//                                     Default with -fno-exceptions.
+//   HINDER_CONTRACT_HANDLER_CONTINUE  log to stderr and continue (continue_assert_handler).
+//   HINDER_CONTRACT_HANDLER_CALLBACK  call the installed contract_callback
+//                                     (callback_assert_handler).
+//
+// The non-throwing handlers never name the exception type, only its spelling, and never include
+// hinder/exception/exception.h, so they work with -fno-exceptions.
+//
+// Level (HINDER_CONTRACT_LEVEL), which checks run:
+//   HINDER_CONTRACT_LEVEL_OFF      none. Conditions are not evaluated.
+//   HINDER_CONTRACT_LEVEL_DEFAULT  HINDER_EXPECTS, HINDER_ENSURES, HINDER_INVARIANT, and
+//                                  HINDER_ASSERT unless NDEBUG is defined. The default.
+//   HINDER_CONTRACT_LEVEL_AUDIT    also the *_AUDIT checks, for conditions too expensive to
+//                                  test in production (e.g. "range is sorted").
+//
+// Example:
+//   #define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_ABORT
+//   #define HINDER_CONTRACT_LEVEL   HINDER_CONTRACT_LEVEL_AUDIT
+//   #include <hinder/assert/contract.h>
+//
+
+#include <format>
+#include <hinder/assert/violation.h>
+#include <hinder/compiler.h>
+#include <hinder/exception/source_info.h>
+#include <hinder/exception/throw_site.h>
+#include <source_location>
+#include <string>
+#include <utility>
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage,cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+// Used in #if preprocessor directives; neither constexpr nor enum values work in #if expressions.
+#define HINDER_CONTRACT_HANDLER_THROW    1
+#define HINDER_CONTRACT_HANDLER_ABORT    2
+#define HINDER_CONTRACT_HANDLER_CONTINUE 3
+#define HINDER_CONTRACT_HANDLER_CALLBACK 4
+
+#define HINDER_CONTRACT_LEVEL_OFF     0
+#define HINDER_CONTRACT_LEVEL_DEFAULT 1
+#define HINDER_CONTRACT_LEVEL_AUDIT   2
+
+#if !defined(HINDER_CONTRACT_HANDLER)
+    #if defined(__cpp_exceptions)
+        #define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_THROW
+    #else
+        #define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_ABORT
+    #endif
+#endif
+
+#if !defined(HINDER_CONTRACT_LEVEL)
+    #define HINDER_CONTRACT_LEVEL HINDER_CONTRACT_LEVEL_DEFAULT
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage,cppcoreguidelines-macro-to-enum,modernize-macro-to-enum)
+
+#if HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_THROW
+    #if !defined(__cpp_exceptions)
+        #error "HINDER_CONTRACT_HANDLER_THROW requires exceptions; choose a non-throwing handler"
+    #endif
+    #include <hinder/assert/handlers/throw.h>
+#elif HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_ABORT
+    #include <hinder/assert/handlers/abort.h>
+#elif HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_CONTINUE
+    #include <hinder/assert/handlers/continue.h>
+#elif HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_CALLBACK
+    #include <hinder/assert/handlers/callback.h>
+#else
+    #error "HINDER_CONTRACT_HANDLER must be one of the HINDER_CONTRACT_HANDLER_* values"
+#endif
+
+namespace hinder::detail {
+
+    //
+    // HINDER_ASSERT failure path for the non-throwing handlers: format the message, then hand
+    // the violation to Handler. Cold and never inlined, like the throwing path.
+    //
+    template <typename Handler, typename... Args>
+    HINDER_COLD HINDER_NOINLINE auto assertion_violated(throw_site const &          site,
+                                                        std::source_location        loc,
+                                                        std::format_string<Args...> fmt,
+                                                        Args &&... args) -> void {
+        auto const message = std::format(fmt, std::forward<Args>(args)...);
+        Handler::handle(contract_violation {site, "assertion_error", source_info {loc}, message});
+    }
+
+}  // namespace hinder::detail
+
+//
+// Yield a reference to a static hinder::throw_site for the enclosing check.
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): needs #cond stringification at the call site
+#define HINDER_CONTRACT_SITE(cond_text, check)                             \
+    []() -> ::hinder::throw_site const & {                                 \
+        static constexpr ::hinder::throw_site site {(cond_text), (check)}; \
+        return site;                                                       \
+    }()
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+//
+// Failure path of one check, for the selected handler. Implementation detail of the contract
+// macros; the condition and exception texts are stringified by the public macro so that macros
+// in the condition are not expanded first.
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): selects the handler at preprocessing time
+#if HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_THROW
+    #define HINDER_CONTRACT_FAIL(except, except_text, site)    \
+        ::hinder::throw_assert_handler::contract_failed<except>( \
+            (site), std::source_location::current())
+    #define HINDER_CONTRACT_ASSERT_FAIL(site, ...)           \
+        ::hinder::throw_assert_handler::assertion_failed(    \
+            (site), std::source_location::current(), __VA_ARGS__)
+#else
+    #if HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_ABORT
+        #define HINDER_CONTRACT_HANDLER_TYPE ::hinder::abort_assert_handler
+    #elif HINDER_CONTRACT_HANDLER == HINDER_CONTRACT_HANDLER_CONTINUE
+        #define HINDER_CONTRACT_HANDLER_TYPE ::hinder::continue_assert_handler
+    #else
+        #define HINDER_CONTRACT_HANDLER_TYPE ::hinder::callback_assert_handler
+    #endif
+    #define HINDER_CONTRACT_FAIL(except, except_text, site)                   \
+        HINDER_CONTRACT_HANDLER_TYPE::handle(::hinder::contract_violation {  \
+            (site), (except_text), ::hinder::source_info {std::source_location::current()}})
+    #define HINDER_CONTRACT_ASSERT_FAIL(site, ...)                           \
+        ::hinder::detail::assertion_violated<HINDER_CONTRACT_HANDLER_TYPE>(  \
+            (site), std::source_location::current(), __VA_ARGS__)
+#endif
+
+#define HINDER_CONTRACT_CHECK(cond, cond_text, except, except_text, check) \
+    HINDER_LIKELY(cond) ? HINDER_NOOP                                      \
+                        : HINDER_CONTRACT_FAIL(except, except_text,        \
+                                               HINDER_CONTRACT_SITE(cond_text, check))
+
+// Type-checks cond without evaluating it.
+#define HINDER_CONTRACT_IGNORE(cond) static_cast<void>(sizeof(static_cast<bool>(cond)))
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+//
+// Contract checking macros.
+//
+// These macros auto-capture the condition text as the "condition" key.
+// They also set "check_type" to identify the contract type.
+//
+// A passing check costs one predicted branch: the failure path is an out-of-line, cold call that
+// receives a static per-site descriptor (see hinder::throw_site).
+//
+// The *_AUDIT variants are only checked at HINDER_CONTRACT_LEVEL_AUDIT.
+//
+// Parameters:
+//   cond    Condition to test, fail on false.
+//   except  The type of exception to throw if cond is false (throw handler), or the name
+//           reported to the other handlers.
+//
+// Example:
+//   HINDER_EXPECTS(ptr != nullptr, null_pointer_error);
+//   // Throws with: condition="ptr != nullptr", check_type="precondition"
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): requires #cond stringification
+#if HINDER_CONTRACT_LEVEL >= HINDER_CONTRACT_LEVEL_DEFAULT
+    #define HINDER_EXPECTS(cond, except) \
+        HINDER_CONTRACT_CHECK(cond, #cond, except, #except, "precondition")
+    #define HINDER_ENSURES(cond, except) \
+        HINDER_CONTRACT_CHECK(cond, #cond, except, #except, "postcondition")
+    #define HINDER_INVARIANT(cond, except) \
+        HINDER_CONTRACT_CHECK(cond, #cond, except, #except, "invariant")
+#else
+    #define HINDER_EXPECTS(cond, except)   HINDER_CONTRACT_IGNORE(cond)
+    #define HINDER_ENSURES(cond, except)   HINDER_CONTRACT_IGNORE(cond)
+    #define HINDER_INVARIANT(cond, except) HINDER_CONTRACT_IGNORE(cond)
+#endif
+
+#if HINDER_CONTRACT_LEVEL >= HINDER_CONTRACT_LEVEL_AUDIT
+    #define HINDER_EXPECTS_AUDIT(cond, except)   HINDER_EXPECTS(cond, except)
+    #define HINDER_ENSURES_AUDIT(cond, except)   HINDER_ENSURES(cond, except)
+    #define HINDER_INVARIANT_AUDIT(cond, except) HINDER_INVARIANT(cond, except)
+#else
+    #define HINDER_EXPECTS_AUDIT(cond, except)   HINDER_CONTRACT_IGNORE(cond)
+    #define HINDER_ENSURES_AUDIT(cond, except)   HINDER_CONTRACT_IGNORE(cond)
+    #define HINDER_INVARIANT_AUDIT(cond, except) HINDER_CONTRACT_IGNORE(cond)
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+//
+// Debug-only assertion macro.
+//
+// Unlike contract macros (EXPECTS/ENSURES/INVARIANT), HINDER_ASSERT is only checked
+// in debug builds (when NDEBUG is not defined). In release builds, or at
+// HINDER_CONTRACT_LEVEL_OFF, it compiles to a no-op with zero overhead.
+//
+// Parameters:
+//   cond    Condition to test, fail with assertion_error on false.
+//   fmt     Format string (std::format syntax).
+//   ...     Format arguments (optional).
+//
+// Examples:
+//   HINDER_ASSERT(ptr != nullptr, "pointer must not be null");
+//   HINDER_ASSERT(x > 0, "x={} must be positive", x);
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): requires #cond stringification and NDEBUG conditional
+#if defined(NDEBUG) || HINDER_CONTRACT_LEVEL == HINDER_CONTRACT_LEVEL_OFF
+    #define HINDER_ASSERT(cond, ...) ((void)(0))
+#else
+    #define HINDER_ASSERT(cond, ...)                                                           \
+        HINDER_LIKELY(cond)                                                                    \
+            ? HINDER_NOOP                                                                      \
+            : HINDER_CONTRACT_ASSERT_FAIL(HINDER_CONTRACT_SITE(#cond, "assertion"), __VA_ARGS__)
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
@@ -0,0 +1,72 @@
+#pragma once
+
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/assert/violation.h>
+#include <hinder/compiler.h>
+
+namespace hinder {
+
+    //
+    // Function called by callback_assert_handler for each violation.
+    //
+    // It may return (execution continues after the check), terminate the process, or, where
+    // exceptions are enabled, throw.
+    //
+    using contract_callback = void (*)(contract_violation const & violation);
+
+    //
+    // Install the process-wide contract callback; nullptr uninstalls it. Returns the previous
+    // callback. Thread-safe.
+    //
+    auto set_contract_callback(contract_callback callback) noexcept -> contract_callback;
+
+    //
+    // The installed contract callback, or nullptr.
+    //
+    [[nodiscard]] auto get_contract_callback() noexcept -> contract_callback;
+
+    //
+    // Assert handler: pass the violation to the installed contract callback.
+    //
+    // Lets an application route violations to its own logging or crash reporting at run time.
+    // With no callback installed it behaves like abort_assert_handler. Select it per
+    // translation unit with
+    //   #define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_CALLBACK
+    // (see hinder/assert/contract.h).
+    //
+    // Example:
+    //   hinder::set_contract_callback([](hinder::contract_violation const & violation) {
+    //       metrics::count("contract_violation", violation.site.condition);
+    //   });
+    //
+    struct callback_assert_handler {
+        HINDER_COLD HINDER_NOINLINE static auto handle(contract_violation const & violation)
+            -> void;
+    };
+
+}  // namespace hinder
@@ -0,0 +1,48 @@
+#pragma once
+
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/assert/violation.h>
+#include <hinder/compiler.h>
+
+namespace hinder {
+
+    //
+    // Assert handler: log the violation to stderr and carry on.
+    //
+    // For code that would rather run degraded than stop, e.g. to find every violation in one
+    // soak test. Execution continues after the failed check, so the code that follows must
+    // tolerate it. Select it per translation unit with
+    //   #define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_CONTINUE
+    // (see hinder/assert/contract.h).
+    //
+    struct continue_assert_handler {
+        HINDER_COLD HINDER_NOINLINE static auto
+        handle(contract_violation const & violation) noexcept -> void;
+    };
+
+}  // namespace hinder
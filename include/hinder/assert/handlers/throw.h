@@ -0,0 +1,70 @@
+#pragma once
+
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <format>
+#include <hinder/compiler.h>
+#include <hinder/exception/exception.h>
+#include <hinder/exception/throw_site.h>
+#include <source_location>
+#include <utility>
+
+namespace hinder {
+
+    //
+    // Assert handler: throw the exception named by the check.
+    //
+    // The default when exceptions are enabled. HINDER_EXPECTS(cond, except) throws except with
+    // the "condition" and "check_type" entries; HINDER_ASSERT throws hinder::assertion_error
+    // with the formatted message.
+    //
+    // Both failure paths are cold and never inlined, so a passing check compiles to one
+    // predicted branch and the throw code lives in a separate text section. One instantiation
+    // per exception type is shared by every site that throws it.
+    //
+    // Each check passes its static throw_site. The location is passed separately:
+    // std::source_location is a single pointer, and taking it at the macro keeps function_name()
+    // naming the enclosing function.
+    //
+    struct throw_assert_handler {
+        template <typename Except>
+        [[noreturn]] HINDER_COLD HINDER_NOINLINE static auto
+        contract_failed(throw_site const & site, std::source_location loc) -> void {
+            throw Except(loc).with_site(site);
+        }
+
+        template <typename... Args>
+        [[noreturn]] HINDER_COLD HINDER_NOINLINE static auto
+        assertion_failed(throw_site const &         site,
+                         std::source_location       loc,
+                         std::format_string<Args...> fmt,
+                         Args &&... args) -> void {
+            throw assertion_error(loc).message(fmt, std::forward<Args>(args)...).with_site(site);
+        }
+    };
+
+}  // namespace hinder
@@ -0,0 +1,66 @@
+#pragma once
+
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/compiler.h>
+#include <hinder/exception/source_info.h>
+#include <hinder/exception/throw_site.h>
+#include <string_view>
+
+namespace hinder {
+
+    //
+    // A failed contract check, as seen by a non-throwing assert handler.
+    //
+    // Everything it refers to is static except message: the site and the exception type name
+    // are string literals from the check, and message (HINDER_ASSERT only) lives until the
+    // handler returns. Copy anything a handler needs to keep.
+    //
+    // Example:
+    //   HINDER_EXPECTS(ptr != nullptr, null_pointer_error);
+    //   // site.condition="ptr != nullptr", site.check_type="precondition",
+    //   // exception_type="null_pointer_error"
+    //
+    struct contract_violation {
+        throw_site const & site;
+        std::string_view   exception_type;
+        source_info        location;
+        std::string_view   message {};
+    };
+
+    //
+    // Write one line describing the violation to stderr.
+    //
+    // Does not allocate, so it is safe to call when memory is exhausted. Used by the abort and
+    // continue handlers, and by the callback handler when no callback is installed.
+    //
+    // Example output:
+    //   hinder: precondition failed: ptr != nullptr [null_pointer_error] at file.cpp:42 in load()
+    //
+    HINDER_COLD auto log_violation(contract_violation const & violation) noexcept -> void;
+
+}  // namespace hinder
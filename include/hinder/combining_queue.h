@@ -0,0 +1,307 @@
+#pragma once
+
+//
+// hinder::combining_queue
+//
+// MIT License
+//
+// Copyright (c) 2017-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <hinder/exception/exception.h>
+#include <hinder/platform.h>
+#include <hinder/queue.h>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace hinder {
+
+    // Bounded, thread-safe MPMC queue using flat combining.
+    //
+    // Same interface and semantics as hinder::queue. Instead of every thread taking the lock in
+    // turn, each thread publishes its push/pop request in a slot, and whichever thread acquires
+    // the lock (the "combiner") executes all pending requests in one pass while the container is
+    // hot in its cache. The lock changes hands once per batch rather than once per operation,
+    // which avoids the lock convoy hinder::queue suffers at high thread counts.
+    //
+    // Prefer hinder::queue at low contention: publishing a request costs a little more than an
+    // uncontended lock.
+    //
+    // Capabilities, invariants, and close() semantics: see hinder::queue.
+    //
+    // Thread safety: all public operations are thread-safe.
+    template <typename T, queue_container Container = std::queue<T>>
+    class combining_queue {
+    public:
+        // Use steady_clock to avoid time-travel if the system clock is adjusted.
+        using clock_t    = std::chrono::steady_clock;
+        using duration_t = clock_t::duration;
+
+        // Default timeout for push() and pop(): 60 seconds.
+        static constexpr duration_t default_timeout = std::chrono::seconds(60);
+
+        // Number of publication slots. More threads than this may use the queue; a thread that
+        // finds every slot busy spins until one is released.
+        static constexpr std::size_t slot_count = 64;
+
+        // Construct an instance with the given upper bound on queue size.
+        // Precondition: bound > 0
+        explicit combining_queue(std::size_t bound = std::numeric_limits<std::size_t>::max())
+        : m_bound {bound}
+        {
+            HINDER_EXPECTS(bound > 0, queue_error);
+        }
+
+        ~combining_queue()                                          = default;
+        combining_queue(const combining_queue&)                     = delete;
+        auto operator=(const combining_queue&) -> combining_queue&  = delete;
+        combining_queue(combining_queue&&)                          = delete;
+        auto operator=(combining_queue&&) -> combining_queue&       = delete;
+
+        // Returns true if close() has been called.
+        [[nodiscard]] auto closed() const noexcept -> bool { return m_closed.load(); }
+
+        // Close the queue.
+        // After close(): push() returns false immediately; pop() drains any remaining items then
+        // returns nullopt. All blocked producers and consumers are woken.
+        // Idempotent: calling close() on an already-closed queue is harmless.
+        auto close() -> void
+        {
+            {
+                std::unique_lock<std::mutex> lck(m_highlander);
+                m_closed.store(true);
+            }
+            {
+                std::unique_lock<std::mutex> lck(m_park);
+            }
+            m_changed.notify_all();
+        }
+
+        // Lock-free atomic snapshot of the current queue depth.
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size.load(); }
+
+        // Lock-free atomic snapshot of whether the queue is empty.
+        [[nodiscard]] auto empty() const noexcept -> bool { return m_size.load() == 0; }
+
+        // Push a value onto the queue.
+        // Blocks until space is available or the timeout elapses.
+        // Returns true on success; false on timeout or if the queue is closed.
+        // On failure, val is left untouched.
+        template <typename V>
+        [[nodiscard]] auto push(V&& val, duration_t timeout = default_timeout) -> bool
+        {
+            if (m_closed.load()) {
+                return false;
+            }
+            auto apply = [](void* arg, Container& con) -> void {
+                con.push(std::forward<V>(*static_cast<std::remove_reference_t<V>*>(arg)));
+            };
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): restored to V in apply
+            auto* arg = const_cast<void*>(static_cast<const void*>(std::addressof(val)));
+            return execute(op_t::push, apply, arg, timeout);
+        }
+
+        // Pop a value from the queue via move.
+        // Blocks until an item is available or the timeout elapses.
+        // Returns the item on success; nullopt on timeout or if the queue is closed and empty.
+        [[nodiscard]] auto pop(duration_t timeout = default_timeout) -> std::optional<T>
+        {
+            std::optional<T> result;
+            auto apply = [](void* arg, Container& con) -> void {
+                static_cast<std::optional<T>*>(arg)->emplace(std::move(con.front()));
+                con.pop();
+            };
+            if (!execute(op_t::pop, apply, &result, timeout)) {
+                return std::nullopt;
+            }
+            return result;
+        }
+
+    private:
+        using apply_t = void (*)(void*, Container&);
+
+        enum class op_t : std::uint8_t { push, pop };
+
+        // Slot lifecycle: free -> claimed (by its owner) -> pending -> done/rejected/failed
+        // (by the combiner) -> pending (owner retries) or free (owner finished).
+        enum class state_t : std::uint8_t { free, claimed, pending, done, rejected, failed };
+
+        struct alignas(cache_line_size) slot_t {
+            std::atomic<state_t> state {state_t::free};
+            op_t                 op {op_t::push};
+            apply_t              apply {nullptr};
+            void*                arg {nullptr};
+            std::exception_ptr   error;     // set when apply throws (state == failed)
+        };
+
+        auto claim_slot() -> slot_t&
+        {
+            auto const start = std::hash<std::thread::id> {}(std::this_thread::get_id());
+            while (true) {
+                for (std::size_t idx = 0; idx < slot_count; ++idx) {
+                    auto& slot     = m_slots[(start + idx) % slot_count];
+                    auto expected  = state_t::free;
+                    if (slot.state.load(std::memory_order_relaxed) == state_t::free
+                        && slot.state.compare_exchange_strong(expected, state_t::claimed)) {
+                        return slot;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        // Publish a request and see it through to completion, retrying rejected requests until
+        // the deadline passes.
+        auto execute(op_t op, apply_t apply, void* arg, duration_t timeout) -> bool
+        {
+            auto const deadline = clock_t::now() + timeout;
+            auto& slot          = claim_slot();
+            slot.op             = op;
+            slot.apply          = apply;
+            slot.arg            = arg;
+
+            while (true) {
+                auto const seen = m_version.load();
+                slot.state.store(state_t::pending, std::memory_order_release);
+                combine_or_wait(slot);
+
+                auto const state = slot.state.load(std::memory_order_acquire);
+                if (state == state_t::done) {
+                    slot.state.store(state_t::free, std::memory_order_release);
+                    return true;
+                }
+                if (state == state_t::failed) {
+                    auto error = std::exchange(slot.error, nullptr);
+                    slot.state.store(state_t::free, std::memory_order_release);
+                    std::rethrow_exception(error);
+                }
+                // Rejected: the queue was full (push), empty (pop), or closed.
+                if (m_closed.load() || !wait_for_change(seen, deadline)) {
+                    slot.state.store(state_t::free, std::memory_order_release);
+                    return false;
+                }
+            }
+        }
+
+        // Spin until another thread completes this request or the lock becomes available, in
+        // which case this thread becomes the combiner.
+        auto combine_or_wait(slot_t& slot) -> void
+        {
+            constexpr int spin_limit = 64;
+            while (slot.state.load(std::memory_order_acquire) == state_t::pending) {
+                if (m_highlander.try_lock()) {
+                    std::lock_guard<std::mutex> lck(m_highlander, std::adopt_lock);
+                    combine();
+                    continue;
+                }
+                for (int spin = 0; spin < spin_limit; ++spin) {
+                    if (slot.state.load(std::memory_order_acquire) != state_t::pending) {
+                        return;
+                    }
+                    cpu_relax();
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        // Execute every pending request in one pass. Requires m_highlander.
+        auto combine() -> void
+        {
+            bool changed = false;
+            for (auto& slot : m_slots) {
+                if (slot.state.load(std::memory_order_acquire) != state_t::pending) {
+                    continue;
+                }
+                const bool is_push = slot.op == op_t::push;
+                const bool ready   = is_push ? !m_closed.load() && m_queue.size() < m_bound
+                                             : !m_queue.empty();
+                if (!ready) {
+                    slot.state.store(state_t::rejected, std::memory_order_release);
+                    continue;
+                }
+                try {
+                    slot.apply(slot.arg, m_queue);
+                } catch (...) {
+                    slot.error = std::current_exception();
+                    slot.state.store(state_t::failed, std::memory_order_release);
+                    continue;
+                }
+                if (is_push) {
+                    m_size.fetch_add(1);
+                } else {
+                    m_size.fetch_sub(1);
+                }
+                changed = true;
+                slot.state.store(state_t::done, std::memory_order_release);
+            }
+
+            if (changed) {
+                // Pairs with wait_for_change(): either the waiter sees the new version, or we see
+                // the waiter and wake it.
+                m_version.fetch_add(1);
+                if (m_waiters.load() != 0) {
+                    {
+                        std::unique_lock<std::mutex> lck(m_park);
+                    }
+                    m_changed.notify_all();
+                }
+            }
+        }
+
+        // Block until a combining pass changes the queue, the queue closes, or the deadline
+        // passes. Returns false on timeout.
+        auto wait_for_change(std::uint64_t seen, clock_t::time_point deadline) -> bool
+        {
+            m_waiters.fetch_add(1);
+            std::unique_lock<std::mutex> lck(m_park);
+            const bool changed = m_changed.wait_until(lck, deadline, [this, seen]() -> bool {
+                return m_closed.load() || m_version.load() != seen;
+            });
+            m_waiters.fetch_sub(1);
+            return changed;
+        }
+
+        Container                       m_queue {};
+        const std::size_t               m_bound;
+        std::atomic<std::size_t>        m_size {0};
+        std::atomic<bool>               m_closed {false};
+        std::mutex                      m_highlander;   // there can be only one (combiner)
+        std::array<slot_t, slot_count>  m_slots {};
+        std::atomic<std::uint64_t>      m_version {0};  // bumped by each pass that changes m_queue
+        std::atomic<std::size_t>        m_waiters {0};  // threads parked in wait_for_change()
+        std::mutex                      m_park;
+        std::condition_variable         m_changed;      // the queue was changed or closed
+    };
+
+}  // namespace hinder
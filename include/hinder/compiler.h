@@ -56,6 +56,41 @@
 #endif
 // NOLINTEND(cppcoreguidelines-macro-usage)
 
+//
+// Code placement hints for failure paths.
+//
+// HINDER_COLD marks a function as rarely executed: the compiler optimizes it for size, places it
+// in a separate text section, and treats branches leading to it as unlikely. HINDER_NOINLINE
+// keeps it out of line so its body never bloats the caller.
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): wraps compiler-specific attributes
+#if defined(__clang__) || defined(__GNUC__)
+    #define HINDER_COLD     [[gnu::cold]]
+    #define HINDER_NOINLINE [[gnu::noinline]]
+#elif defined(_MSC_VER)
+    #define HINDER_COLD
+    #define HINDER_NOINLINE __declspec(noinline)
+#else
+    #define HINDER_COLD
+    #define HINDER_NOINLINE
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+//
+// Let a class with a non-trivial copy constructor or destructor be passed in registers.
+//
+// HINDER_TRIVIAL_ABI expands to [[clang::trivial_abi]] on Clang and to nothing elsewhere. The
+// class must stay valid when its bytes are moved to another address (no self-pointers); the
+// callee, not the caller, then destroys by-value parameters.
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): wraps a compiler-specific attribute
+#if defined(__clang__)
+    #define HINDER_TRIVIAL_ABI [[clang::trivial_abi]]
+#else
+    #define HINDER_TRIVIAL_ABI
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
 //
 // DEPRECATED: Use [[nodiscard]] attribute directly.
 // This macro is retained for backward compatibility but will be removed in a future version.
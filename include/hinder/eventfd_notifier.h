@@ -0,0 +1,96 @@
+#pragma once
+
+//
+// hinder::queue
+//
+// MIT License
+//
+// Copyright (c) 2017-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <hinder/queue.h>
+#include <queue>
+
+#if defined(__linux__)
+
+namespace hinder {
+
+    //
+    // queue_notifier that signals a Linux eventfd, for event loops (epoll, io_uring, ...) that
+    // cannot block in queue::pop().
+    //
+    // Notifications are coalesced: after the first push() the fd stays readable, and further
+    // pushes do nothing until the consumer calls reset(). A burst of pushes therefore produces a
+    // single wakeup.
+    //
+    // Consumer protocol, when the fd is reported readable:
+    //   1. notifier.reset()          -- consume the wakeup and re-arm
+    //   2. que.try_pop_bulk(out)     -- drain without blocking, until it returns 0
+    // Resetting before draining guarantees that an item pushed during the drain either is drained
+    // or re-signals the fd. Items already queued at the reset do not re-signal it: a consumer
+    // that passes max_items must keep calling try_pop_bulk() until it returns 0 (or until size()
+    // is 0) before waiting on the fd again, or it sleeps with items still queued.
+    //
+    // Example:
+    //   hinder::eventfd_queue<Message> que;
+    //   epoll_event ev {.events = EPOLLIN, .data = {.ptr = &que}};
+    //   epoll_ctl(epfd, EPOLL_CTL_ADD, que.notifier().fd(), &ev);
+    //   ...
+    //   // on EPOLLIN:
+    //   que.notifier().reset();
+    //   while (que.try_pop_bulk(std::back_inserter(batch), 64) != 0) { ... }
+    //
+    class eventfd_notifier {
+    public:
+        // Create a non-blocking, close-on-exec eventfd. Throws queue_error on failure.
+        eventfd_notifier();
+        ~eventfd_notifier();
+
+        eventfd_notifier(eventfd_notifier const &)                     = delete;
+        auto operator=(eventfd_notifier const &) -> eventfd_notifier & = delete;
+        eventfd_notifier(eventfd_notifier &&)                          = delete;
+        auto operator=(eventfd_notifier &&) -> eventfd_notifier &      = delete;
+
+        // The file descriptor to register for readability (EPOLLIN).
+        [[nodiscard]] auto fd() const noexcept -> int { return m_fd; }
+
+        // Make the fd readable unless a notification is already pending.
+        auto notify() noexcept -> void;
+
+        // Consume any pending notification and re-arm. Call before draining the queue, then drain
+        // it completely: items already queued do not signal again.
+        auto reset() noexcept -> void;
+
+    private:
+        int               m_fd {-1};
+        std::atomic<bool> m_signalled {false};  // a notification is pending on m_fd
+    };
+
+    //
+    // hinder::queue that signals an eventfd_notifier after each push().
+    //
+    template <typename T, queue_container Container = std::queue<T>>
+    using eventfd_queue = queue<T, Container, eventfd_notifier>;
+
+}  // namespace hinder
+
+#endif  // __linux__
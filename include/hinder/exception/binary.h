@@ -0,0 +1,153 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <hinder/exception/error_record.h>
+#include <hinder/exception/exception_data.h>
+#include <hinder/exception/format_sink.h>
+#include <hinder/exception/source_info.h>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace hinder {
+
+    class exception;
+
+    // ========================================================================
+    // Binary records
+    // ========================================================================
+
+    //
+    // A compact binary encoding of an exception's or error's type, source and key-value data, for
+    // high-volume IPC where JSON is too large and too slow to write. Context frames and stack
+    // traces are not encoded.
+    //
+    // Layout, version 1:
+    //
+    //   record := version:u8 flags:u8 type:string [file:string line:varint] count:varint entry*
+    //   flags  := bit 0 set if file and line follow
+    //   entry  := key value
+    //   key    := varint k. k odd: entry k >> 1 of the key_dictionary. k even: the name follows
+    //             inline, k >> 1 bytes
+    //   value  := tag:u8, then by tag:
+    //               0 flag (nothing)   1 false   2 true
+    //               3 int64_t   zigzag varint
+    //               4 uint64_t  varint
+    //               5 double    8 bytes, IEEE 754, little-endian
+    //               6 string    string
+    //   string := length:varint bytes
+    //   varint := unsigned LEB128: 7 bits per byte, least significant first, high bit set on
+    //             every byte but the last
+    //
+    // Every value keeps its exact type, unlike JSON. Encoding writes through a format_sink, so
+    // into a caller's buffer or iterator it allocates nothing.
+    //
+
+    //
+    // Keys agreed on by the writer and the reader of binary records. A key found in the
+    // dictionary is encoded as its index (usually one byte) instead of its name. Both sides must
+    // use the same keys in the same order.
+    //
+    // The dictionary refers to the given strings, which must outlive it; string literals are
+    // the usual choice.
+    //
+    // Example:
+    //   static hinder::key_dictionary const keys {"message", "path", "errno"};
+    //   auto const bytes = hinder::to_binary(exc, &keys);
+    //
+    class key_dictionary {
+    public:
+        key_dictionary(std::initializer_list<std::string_view> keys);
+        explicit key_dictionary(std::span<std::string_view const> keys);
+
+        // Index of key, if it is in the dictionary.
+        [[nodiscard]] auto find(std::string_view key) const -> std::optional<std::uint32_t>;
+
+        // Key at index, if index is in range.
+        [[nodiscard]] auto key(std::uint64_t index) const -> std::optional<std::string_view>;
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return m_keys.size(); }
+
+    private:
+        std::vector<std::string_view>                       m_keys;
+        std::unordered_map<std::string_view, std::uint32_t> m_index;
+    };
+
+    namespace detail {
+
+        // The whole record; shared by the exception and error encoders.
+        auto write_binary_record(format_sink &          sink,
+                                 std::string_view       type_name,
+                                 source_info const &    loc,
+                                 exception_data const & data,
+                                 key_dictionary const * dict) -> void;
+
+        auto write_binary(format_sink & sink, exception const & exc, key_dictionary const * dict)
+            -> void;
+
+    }  // namespace detail
+
+    //
+    // Encode exc as a binary record.
+    //
+    [[nodiscard]] auto to_binary(exception const & exc, key_dictionary const * dict = nullptr)
+        -> std::string;
+
+    //
+    // As to_binary(), written to an output iterator (returned advanced), or into a fixed buffer
+    // returning the length of the full record, which was truncated if larger than buffer.size().
+    //
+    template <detail::format_output Out>
+    auto to_binary_to(Out out, exception const & exc, key_dictionary const * dict = nullptr)
+        -> Out {
+        format_sink sink(out);
+        detail::write_binary(sink, exc, dict);
+        sink.flush();
+        return out;
+    }
+
+    auto to_binary_to(std::span<char>        buffer,
+                      exception const &      exc,
+                      key_dictionary const * dict = nullptr) -> std::size_t;
+
+    //
+    // Decode one binary record, which must fill bytes exactly. Pass the dictionary it was
+    // encoded with, if any.
+    //
+    [[nodiscard]] auto parse_binary_record(std::string_view       bytes,
+                                           key_dictionary const * dict = nullptr)
+        -> std::expected<error_record, record_parse_error>;
+
+}  // namespace hinder
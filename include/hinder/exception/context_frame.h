@@ -0,0 +1,48 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/source_info.h>
+
+namespace hinder {
+
+    //
+    // One step of an error's propagation path: where it was passed on, and an optional note.
+    //
+    // HINDER_TRY appends one each time it returns an error to its caller. The first frame
+    // allocates the payload block's frame array (see hinder::exception_data); later frames do not
+    // allocate, and those past its capacity are only counted.
+    //
+    // note must have static storage duration (typically a string literal); only the pointer is
+    // stored.
+    //
+    struct context_frame {
+        source_info  location;
+        char const * note {nullptr};
+    };
+
+}  // namespace hinder
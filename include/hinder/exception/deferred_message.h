@@ -0,0 +1,114 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstddef>
+#include <format>
+#include <hinder/exception/exception_data.h>
+#include <hinder/exception/exception_value.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace hinder {
+
+    namespace detail {
+
+        // Argument types that are safe to capture for formatting later: plain values and strings
+        // (copied). Anything else (spans, views, user types that may refer to external state) is
+        // formatted eagerly instead.
+        template <typename T>
+        inline constexpr bool is_deferrable_v =
+            is_string_like_v<T> || std::is_arithmetic_v<std::decay_t<T>>
+            || std::is_same_v<std::decay_t<T>, void const *>
+            || std::is_same_v<std::decay_t<T>, void *>
+            || std::is_same_v<std::decay_t<T>, std::nullptr_t>;
+
+        // Strings are stored owned; everything else by value.
+        template <typename T>
+        using deferred_arg_t =
+            std::conditional_t<is_string_like_v<T>, std::string, std::decay_t<T>>;
+
+        //
+        // A std::format call captured at the throw site and run on first read.
+        //
+        // The format string is checked at compile time against the caller's argument types. Stored
+        // arguments format identically (std::string in place of char const * / std::string_view),
+        // so the runtime std::vformat cannot fail on the format string. Only a view of the format
+        // string is kept, so its characters must outlive the value: a string literal (static
+        // storage) always does, but a constexpr char array with automatic storage does not.
+        //
+        template <typename... Stored>
+        class deferred_format final : public deferred_value {
+        public:
+            template <typename... Args>
+            explicit deferred_format(std::string_view fmt, Args &&... args)
+            : m_fmt(fmt),
+              m_args(std::forward<Args>(args)...) {}
+
+            [[nodiscard]] auto render() const -> exception_value override {
+                return std::apply(
+                    [this](auto const &... args) -> exception_value {
+                        return std::vformat(m_fmt, std::make_format_args(args...));
+                    },
+                    m_args);
+            }
+
+            [[nodiscard]] auto clone() const -> std::unique_ptr<deferred_value> override {
+                return std::make_unique<deferred_format>(*this);
+            }
+
+            deferred_format(deferred_format const & other)
+            : m_fmt(other.m_fmt),
+              m_args(other.m_args) {}
+
+        private:
+            std::string_view      m_fmt;
+            std::tuple<Stored...> m_args;
+        };
+
+        //
+        // Build the value stored under "message": a deferred_format when every argument can be
+        // captured safely, otherwise the eagerly formatted string.
+        //
+        template <typename... Args>
+        auto make_message(std::format_string<Args...> fmt, Args &&... args) {
+            if constexpr ((is_deferrable_v<Args> && ...)) {
+                return std::unique_ptr<deferred_value>(
+                    std::make_unique<deferred_format<deferred_arg_t<Args>...>>(
+                        fmt.get(), std::forward<Args>(args)...));
+            } else {
+                return std::format(fmt, std::forward<Args>(args)...);
+            }
+        }
+
+    }  // namespace detail
+
+}  // namespace hinder
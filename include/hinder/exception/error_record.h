@@ -0,0 +1,58 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <hinder/exception/exception_data.h>
+#include <string>
+
+namespace hinder {
+
+    //
+    // The type, source and key-value data of an exception or error, decoded from one of its
+    // serialized forms (parse_json_record(), parse_binary_record()).
+    //
+    // The record owns copies of its names and data, so it stays valid whatever happens to the
+    // encoded text, and untrusted input cannot grow any process-wide state.
+    //
+    struct error_record {
+        std::string         type_name;
+        std::string         file;  // empty if the record has no source
+        std::uint_least32_t line {0};
+        exception_data      data;
+    };
+
+    //
+    // Why a record was rejected, and the byte offset at which decoding stopped.
+    //
+    struct record_parse_error {
+        char const * reason;  // static string
+        std::size_t  offset;
+    };
+
+}  // namespace hinder
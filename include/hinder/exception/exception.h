@@ -26,14 +26,24 @@
 // SOFTWARE.
 //
 
+#include <concepts>
 #include <cstddef>
 #include <format>
-#include <functional>
 #include <hinder/compiler.h>
+#include <hinder/exception/context_frame.h>
+#include <hinder/exception/deferred_message.h>
+#include <hinder/exception/exception_data.h>
+#include <hinder/exception/exception_key.h>
 #include <hinder/exception/exception_value.h>
-#include <map>
+#include <hinder/exception/format_sink.h>
+#include <hinder/exception/source_info.h>
+#include <hinder/exception/stack_trace.h>
+#include <hinder/exception/throw_site.h>
+#include <hinder/exception/throw_stats.h>
+#include <memory>
 #include <optional>
 #include <source_location>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -63,25 +73,30 @@ namespace hinder {
     //
     class exception : public std::runtime_error {
     public:
-        using data_map       = std::map<std::string, exception_value, std::less<>>;
+        using data_map       = exception_data;
         using const_iterator = data_map::const_iterator;
 
+        static constexpr std::string_view static_type_name {"exception"};
+
         explicit exception(std::source_location loc = std::source_location::current());
 
         // Fluent API for adding data (returns exception& for base class)
         template <typename T>
-        auto with(std::string_view key, T && value) -> exception & {
-            m_data[std::string(key)] = detail::to_exception_value(std::forward<T>(value));
+        auto with(exception_key key, T && value) -> exception & {
+            m_data.set(std::move(key), detail::to_exception_value(std::forward<T>(value)));
             return *this;
         }
 
         // Flag-style with (key exists, no value)
-        auto with(std::string_view key) -> exception &;
+        auto with(exception_key key) -> exception &;
 
-        // Convenience for the common "message" key
+        // Attach the static description of the throw site (see hinder::throw_site)
+        auto with_site(throw_site const & site) -> exception &;
+
+        // Convenience for the common "message" key. fmt must have static storage duration.
         template <typename... Args>
         auto message(std::format_string<Args...> fmt, Args &&... args) -> exception & {
-            m_data["message"] = std::format(fmt, std::forward<Args>(args)...);
+            m_data.set("message", detail::make_message<Args...>(fmt, std::forward<Args>(args)...));
             return *this;
         }
 
@@ -89,33 +104,78 @@ namespace hinder {
         [[nodiscard]] auto get(std::string_view key) const -> std::optional<exception_value>;
         [[nodiscard]] auto contains(std::string_view key) const -> bool;
 
-        // Typed access with conversion
+        // Typed access with conversion. get_as<std::string_view> views a stored string without
+        // copying it; other stored types yield nullopt.
         template <typename T>
         [[nodiscard]] auto get_as(std::string_view key) const -> std::optional<T>;
 
+        // Non-copying access. The pointer and anything visited stay valid until the exception is
+        // modified or destroyed.
+        [[nodiscard]] auto get_ref(std::string_view key) const -> exception_value const *;
+
+        // Call fn with the stored alternative (as by std::visit) if key is present.
+        // Returns false if key is absent.
+        template <typename Fn>
+        auto visit(std::string_view key, Fn && fn) const -> bool {
+            auto const * val = get_ref(key);
+            if (val == nullptr) {
+                return false;
+            }
+            std::visit(std::forward<Fn>(fn), *val);
+            return true;
+        }
+
         // Iteration over all key-value pairs
         [[nodiscard]] auto begin() const -> const_iterator;
         [[nodiscard]] auto end() const -> const_iterator;
         [[nodiscard]] auto size() const -> std::size_t;
 
+        // The whole key-value payload. A copy shares storage with this exception until either
+        // is modified, so handing it to a hinder::error copies no keys or values.
+        [[nodiscard]] auto data() const noexcept -> data_map const &;
+
+        // Context frames carried over from a hinder::error (see hinder::error_exception), and
+        // the number that did not fit.
+        [[nodiscard]] auto frames() const noexcept -> std::span<context_frame const>;
+        [[nodiscard]] auto dropped_frames() const noexcept -> std::size_t;
+
         // Metadata
         [[nodiscard]] auto type_name() const -> std::string_view;
-        [[nodiscard]] auto location() const -> std::source_location const &;
+        [[nodiscard]] auto location() const -> source_info const &;
+
+        // The static throw site attached with with_site() (as by the contract macros), or nullptr.
+        [[nodiscard]] auto site() const noexcept -> throw_site const * { return m_site; }
+
+        // Stack captured at construction, or nullptr. Captured by types defined with
+        // HINDER_DEFINE_TRACED_EXCEPTION, and by every exception when built with
+        // HINDER_WITH_STACK_TRACE.
+        [[nodiscard]] virtual auto trace() const noexcept -> stack_trace const *;
 
         // std::exception interface
         [[nodiscard]] auto what() const noexcept -> char const * override;
 
     protected:
-        void set_type_name(std::string_view name);
+        // name must have static storage duration; only the pointer is stored.
+        void set_type_name(char const * name);
 
         // Protected implementation methods for CRTP derived classes
-        void with_impl(std::string_view key, exception_value val);
+        void with_impl(exception_key key, exception_value val);
         void message_impl(std::string msg);
+        void message_impl(std::unique_ptr<detail::deferred_value> msg);
+        void site_impl(throw_site const & site);
+
+        // Replace the location and payload, e.g. with those of a hinder::error (see
+        // hinder::error_exception).
+        void adopt_impl(source_info loc, data_map data);
 
     private:
-        std::string          m_type_name {"exception"};
-        std::source_location m_location;
-        data_map             m_data;
+        char const *                      m_type_name {"exception"};  // static, per type
+        throw_site const *                m_site {nullptr};
+        [[no_unique_address]] source_info m_location;  // empty unless HINDER_WITH_EXCEPTION_SOURCE
+        data_map                          m_data;
+#if defined(HINDER_WITH_STACK_TRACE)
+        stack_trace                       m_trace;  // captured at construction
+#endif
     };
 
     // ========================================================================
@@ -137,21 +197,27 @@ namespace hinder {
     public:
         // Fluent API returning Derived& to preserve type through chaining
         template <typename T>
-        auto with(std::string_view key, T && value) -> Derived & {
-            Base::with_impl(key, detail::to_exception_value(std::forward<T>(value)));
+        auto with(exception_key key, T && value) -> Derived & {
+            Base::with_impl(std::move(key), detail::to_exception_value(std::forward<T>(value)));
             return static_cast<Derived &>(*this);
         }
 
         // Flag-style with (key exists, no value)
-        auto with(std::string_view key) -> Derived & {
-            Base::with_impl(key, std::monostate {});
+        auto with(exception_key key) -> Derived & {
+            Base::with_impl(std::move(key), std::monostate {});
             return static_cast<Derived &>(*this);
         }
 
         // Convenience for the common "message" key
         template <typename... Args>
         auto message(std::format_string<Args...> fmt, Args &&... args) -> Derived & {
-            Base::message_impl(std::format(fmt, std::forward<Args>(args)...));
+            Base::message_impl(detail::make_message<Args...>(fmt, std::forward<Args>(args)...));
+            return static_cast<Derived &>(*this);
+        }
+
+        // Attach the static description of the throw site (see hinder::throw_site)
+        auto with_site(throw_site const & site) -> Derived & {
+            Base::site_impl(site);
             return static_cast<Derived &>(*this);
         }
 
@@ -180,6 +246,12 @@ namespace hinder {
                     return std::nullopt;
                 } else if constexpr (std::is_same_v<T, val_type>) {
                     return val;
+                } else if constexpr (std::is_same_v<T, std::string_view>) {
+                    if constexpr (std::is_same_v<val_type, std::string>) {
+                        return std::string_view(val);
+                    } else {
+                        return std::nullopt;
+                    }
                 } else if constexpr (std::is_same_v<T, std::string>) {
                     // Convert anything to string
                     return value_to_string(val);
@@ -208,15 +280,53 @@ namespace hinder {
 //       .message("Something failed")
 //       .with("code", 42);  // Still throws my_error, not exception
 //
+// The type name is a static string (my_error::static_type_name); exceptions store a pointer to it.
+//
 // NOLINTBEGIN(bugprone-macro-parentheses): arguments are type names; parenthesizing is invalid
 #define HINDER_DEFINE_EXCEPTION(name, base)                                       \
     class name : public hinder::exception_crtp<name, base> {                      \
     public:                                                                       \
+        static constexpr std::string_view static_type_name {#name};               \
+                                                                                  \
         explicit name(std::source_location loc = std::source_location::current()) \
         : hinder::exception_crtp<name, base>(loc) {                               \
             set_type_name(#name);                                                 \
         }                                                                         \
     }
+
+//
+// As HINDER_DEFINE_EXCEPTION, but every instance captures the stack at construction.
+//
+// Capturing records raw return addresses in a fixed inline buffer (hinder::stack_trace); names
+// are resolved only when the exception is formatted with to_string() or to_json(). When built
+// with HINDER_WITH_STACK_TRACE every exception is traced and this is HINDER_DEFINE_EXCEPTION.
+//
+// Example:
+//   HINDER_DEFINE_TRACED_EXCEPTION(worker_error, hinder::generic_error);
+//
+#if defined(HINDER_WITH_STACK_TRACE)
+    #define HINDER_DEFINE_TRACED_EXCEPTION(name, base) HINDER_DEFINE_EXCEPTION(name, base)
+#else
+    #define HINDER_DEFINE_TRACED_EXCEPTION(name, base)                                \
+        class name : public hinder::exception_crtp<name, base> {                      \
+        public:                                                                       \
+            static constexpr std::string_view static_type_name {#name};               \
+                                                                                      \
+            explicit name(std::source_location loc = std::source_location::current()) \
+            : hinder::exception_crtp<name, base>(loc),                                \
+              m_trace(hinder::stack_trace::capture()) {                               \
+                set_type_name(#name);                                                 \
+            }                                                                         \
+                                                                                      \
+            [[nodiscard]] auto trace() const noexcept                                 \
+                -> hinder::stack_trace const * override {                             \
+                return &m_trace;                                                      \
+            }                                                                         \
+                                                                                      \
+        private:                                                                      \
+            hinder::stack_trace m_trace;                                              \
+        }
+#endif
 // NOLINTEND(bugprone-macro-parentheses)
 
 namespace hinder {
@@ -247,69 +357,21 @@ namespace hinder {
 //       .message("Failed to open file")
 //       .with("path", filename);
 //
-// NOLINTBEGIN(cppcoreguidelines-macro-usage): takes a type name; cannot be a function
-#define HINDER_THROW(except) throw except(std::source_location::current())
-// NOLINTEND(cppcoreguidelines-macro-usage)
-
-//
-// Contract checking macros.
-//
-// These macros auto-capture the condition text as the "condition" key.
-// They also set "check_type" to identify the contract type.
-//
-// Parameters:
-//   cond    Condition to test, throw on false.
-//   except  The type of exception to throw if cond is false.
-//
-// Example:
-//   HINDER_EXPECTS(ptr != nullptr, null_pointer_error);
-//   // Throws with: condition="ptr != nullptr", check_type="precondition"
-//
-
-#define HINDER_EXPECTS(cond, except)                                    \
-    HINDER_LIKELY(cond) ? HINDER_NOOP                                   \
-                        : throw except(std::source_location::current()) \
-                              .with("condition", #cond)                 \
-                              .with("check_type", "precondition")
-
-#define HINDER_ENSURES(cond, except)                                    \
-    HINDER_LIKELY(cond) ? HINDER_NOOP                                   \
-                        : throw except(std::source_location::current()) \
-                              .with("condition", #cond)                 \
-                              .with("check_type", "postcondition")
-
-#define HINDER_INVARIANT(cond, except)                                  \
-    HINDER_LIKELY(cond) ? HINDER_NOOP                                   \
-                        : throw except(std::source_location::current()) \
-                              .with("condition", #cond)                 \
-                              .with("check_type", "invariant")
-
-//
-// Debug-only assertion macro.
-//
-// Unlike contract macros (EXPECTS/ENSURES/INVARIANT), HINDER_ASSERT is only checked
-// in debug builds (when NDEBUG is not defined). In release builds, it compiles to
-// a no-op with zero overhead.
+// With HINDER_WITH_THROW_STATS defined, each site also counts its throws in the global registry
+// (see hinder::collect_throw_stats).
 //
-// Parameters:
-//   cond    Condition to test, throw assertion_error on false.
-//   fmt     Format string (std::format syntax).
-//   ...     Format arguments (optional).
-//
-// Examples:
-//   HINDER_ASSERT(ptr != nullptr, "pointer must not be null");
-//   HINDER_ASSERT(x > 0, "x={} must be positive", x);
-//
-// NOLINTBEGIN(cppcoreguidelines-macro-usage): requires #cond stringification and NDEBUG conditional
-#ifdef NDEBUG
-    #define HINDER_ASSERT(cond, ...) ((void)(0))
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): takes a type name; cannot be a function
+#if defined(HINDER_WITH_THROW_STATS)
+    #define HINDER_THROW(except)                                                             \
+        throw(                                                                               \
+            [](std::source_location loc) -> ::hinder::throw_site_counter & {                 \
+                static ::hinder::throw_site_counter counter {except::static_type_name, loc}; \
+                return counter;                                                              \
+            }(std::source_location::current())                                               \
+                .record(),                                                                   \
+            except(std::source_location::current()))
 #else
-    #define HINDER_ASSERT(cond, ...)                                                           \
-        HINDER_LIKELY(cond) ? HINDER_NOOP                                                      \
-                            : throw ::hinder::assertion_error(std::source_location::current()) \
-                                  .with("condition", #cond)                                    \
-                                  .with("check_type", "assertion")                             \
-                                  .message(__VA_ARGS__)
+    #define HINDER_THROW(except) throw except(std::source_location::current())
 #endif
 // NOLINTEND(cppcoreguidelines-macro-usage)
 
@@ -334,5 +396,91 @@ namespace hinder {
     //
     [[nodiscard]] auto to_json(exception const & exc) -> std::string;
 
+    //
+    // Streaming variants of to_string() and to_json(): write the same text straight to an output
+    // iterator and return the advanced iterator, with no intermediate strings.
+    //
+    // Example:
+    //   hinder::to_json_to(std::back_inserter(log_buffer), exc);
+    //
+    template <detail::format_output Out>
+    auto to_string_to(Out out, exception const & exc) -> Out;
+
+    template <detail::format_output Out>
+    auto to_json_to(Out out, exception const & exc) -> Out;
+
+    //
+    // As above, into a fixed buffer. Returns the length of the full output, like snprintf: the
+    // text was truncated to buffer.size() if the result is larger. Nothing is null-terminated.
+    //
+    auto to_string_to(std::span<char> buffer, exception const & exc) -> std::size_t;
+    auto to_json_to(std::span<char> buffer, exception const & exc) -> std::size_t;
+
+    namespace detail {
+
+        auto write_string(format_sink & sink, exception const & exc) -> void;
+        auto write_json(format_sink & sink, exception const & exc) -> void;
+        auto write_compact(format_sink & sink, exception const & exc) -> void;
+
+    }  // namespace detail
+
+    template <detail::format_output Out>
+    auto to_string_to(Out out, exception const & exc) -> Out {
+        format_sink sink(out);
+        detail::write_string(sink, exc);
+        sink.flush();
+        return out;
+    }
+
+    template <detail::format_output Out>
+    auto to_json_to(Out out, exception const & exc) -> Out {
+        format_sink sink(out);
+        detail::write_json(sink, exc);
+        sink.flush();
+        return out;
+    }
+
 }  // namespace hinder
 
+//
+// std::format support for hinder::exception and every type derived from it, written straight into
+// the format context:
+//   {} or {:h}   as to_string()
+//   {:j}         as to_json()
+//   {:c}         one line: type @file:line key=value ..., with strings quoted as in JSON
+//
+// Example:
+//   catch (hinder::exception const & e) {
+//       std::format_to(std::back_inserter(line), "request failed: {:c}", e);
+//   }
+//
+template <typename Exception>
+    requires std::derived_from<Exception, hinder::exception>
+struct std::formatter<Exception, char> : hinder::detail::style_parser {
+    template <typename FormatContext>
+    auto format(hinder::exception const & exc, FormatContext & ctx) const
+        -> typename FormatContext::iterator {
+        auto                out = ctx.out();
+        hinder::format_sink sink(out);
+        switch (style) {
+        case hinder::detail::format_style::human:
+            hinder::detail::write_string(sink, exc);
+            break;
+        case hinder::detail::format_style::json:
+            hinder::detail::write_json(sink, exc);
+            break;
+        case hinder::detail::format_style::compact:
+            hinder::detail::write_compact(sink, exc);
+            break;
+        }
+        sink.flush();
+        return out;
+    }
+};
+
+
+//
+// Contract checking macros (HINDER_EXPECTS, HINDER_ENSURES, HINDER_INVARIANT, HINDER_ASSERT).
+// Included last: the throwing handler needs the exception types above.
+//
+#include <hinder/assert/contract.h>
@@ -0,0 +1,219 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <hinder/exception/context_frame.h>
+#include <hinder/exception/exception_key.h>
+#include <hinder/exception/exception_value.h>
+#include <hinder/exception/throw_site.h>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace hinder {
+
+    namespace detail {
+
+        // A value computed on first read (e.g., a formatted message). Must be cloneable because
+        // exceptions are copied when thrown.
+        class deferred_value {
+        public:
+            deferred_value()                                           = default;
+            virtual ~deferred_value()                                  = default;
+            deferred_value(deferred_value const &)                     = delete;
+            auto operator=(deferred_value const &) -> deferred_value & = delete;
+            deferred_value(deferred_value &&)                          = delete;
+            auto operator=(deferred_value &&) -> deferred_value &      = delete;
+
+            [[nodiscard]] virtual auto render() const -> exception_value                = 0;
+            [[nodiscard]] virtual auto clone() const -> std::unique_ptr<deferred_value> = 0;
+        };
+
+    }  // namespace detail
+
+    class exception_data;
+
+    namespace detail {
+
+        //
+        // The block behind an exception_data handle: a flat array of (key, value) pairs kept
+        // sorted by key, plus at most one deferred value and one throw_site awaiting render, and
+        // an array of context frames allocated by the first add_frame(). Shared by every copy of
+        // a handle and reference counted; never mutated while shared.
+        //
+        class exception_storage {
+        public:
+            using value_type = std::pair<exception_key, exception_value>;
+
+            static constexpr std::size_t inline_capacity = 8;
+            static constexpr std::size_t frame_capacity  = 24;
+
+            exception_storage() noexcept = default;
+            ~exception_storage();
+
+            // Deep copy, used when a shared block is written to. Does not render.
+            exception_storage(exception_storage const & other);
+            auto operator=(exception_storage const &) -> exception_storage & = delete;
+            exception_storage(exception_storage &&)                          = delete;
+            auto operator=(exception_storage &&) -> exception_storage &      = delete;
+
+        private:
+            friend class hinder::exception_data;
+
+            auto set(exception_key key, exception_value value) -> void;
+            auto set(exception_key key, std::unique_ptr<deferred_value> value) -> void;
+            auto set(throw_site const & site) -> void;
+            auto add_frame(context_frame const & frame) -> void;
+
+            [[nodiscard]] auto find(std::string_view key) const -> value_type const *;
+            [[nodiscard]] auto contains(std::string_view key) const -> bool;
+            [[nodiscard]] auto lower_bound(std::string_view key) const -> std::size_t;
+            auto               render() const -> void;
+            auto               render_site() const -> void;
+            [[nodiscard]] auto is_inline() const noexcept -> bool;
+            auto               inline_storage() noexcept -> value_type *;
+            [[nodiscard]] auto frame_storage() const noexcept -> context_frame const *;
+            auto               reserve(std::size_t capacity) -> void;
+            auto               free_entries() noexcept -> void;
+
+            alignas(value_type) std::byte m_inline[inline_capacity * sizeof(value_type)];  // NOLINT
+            value_type * m_begin {inline_storage()};
+            std::size_t  m_size {0};
+            std::size_t  m_capacity {inline_capacity};
+
+            // Context frames, in the order they were added; those past frame_capacity are only
+            // counted. Allocated on the first frame, so data that never propagates through
+            // HINDER_TRY neither stores nor copies the array.
+            std::unique_ptr<context_frame[]> m_frames;  // NOLINT(*-avoid-c-arrays)
+            std::uint32_t                    m_frame_count {0};
+            std::uint32_t m_frames_dropped {0};
+
+            // Handles sharing this block.
+            std::atomic<std::size_t> m_refs {1};
+
+            // Deferred entries, if any. m_pending is the fast-path check; m_render serializes
+            // rendering against readers through other handles and against deep copies.
+            exception_key                           m_deferred_key {""};
+            mutable std::unique_ptr<deferred_value> m_deferred;
+            mutable throw_site const *              m_site {nullptr};
+            mutable std::atomic<bool>               m_pending {false};
+            mutable std::mutex                      m_render;
+        };
+
+    }  // namespace detail
+
+    //
+    // Key-value storage shared by hinder::exception and hinder::error.
+    //
+    // A handle to a reference-counted, immutable block of (key, value) pairs kept sorted by key,
+    // so iteration is ordered as with std::map. Copying a handle is one atomic increment: errors
+    // passed along std::expected chains and exceptions copied into std::exception_ptr share one
+    // block. set() copies the block first if another handle shares it (copy-on-write). An empty
+    // handle allocates nothing; the first set() allocates one block, whose first inline_capacity
+    // entries need no further allocation.
+    //
+    // One entry may hold a deferred value, rendered on the first read access (begin() or find())
+    // rather than at the throw site. Likewise the entries described by a throw_site are stored as
+    // a pointer and materialized on first read. Rendering is thread-safe and happens at most once
+    // per block, so copies share the result; contains() and size() never trigger it.
+    //
+    // The block also holds up to frame_capacity context frames (see hinder::context_frame). The
+    // first one allocates room for all of them; later frames are counted in dropped_frames().
+    //
+    // Iterators are plain pointers and are invalidated by set().
+    //
+    class exception_data {
+    public:
+        using key_type       = exception_key;
+        using mapped_type    = exception_value;
+        using value_type     = detail::exception_storage::value_type;
+        using const_iterator = value_type const *;
+
+        static constexpr std::size_t inline_capacity = detail::exception_storage::inline_capacity;
+        static constexpr std::size_t frame_capacity  = detail::exception_storage::frame_capacity;
+
+        exception_data() noexcept = default;
+        ~exception_data();
+
+        exception_data(exception_data const & other) noexcept;
+        auto operator=(exception_data const & other) noexcept -> exception_data &;
+        exception_data(exception_data && other) noexcept;
+        auto operator=(exception_data && other) noexcept -> exception_data &;
+
+        // Insert or overwrite the value stored under key.
+        auto set(exception_key key, exception_value value) -> void;
+
+        // Insert or overwrite key with a value rendered on first read. Only one deferred value is
+        // held at a time; a previously deferred value under another key is rendered first.
+        auto set(exception_key key, std::unique_ptr<detail::deferred_value> value) -> void;
+
+        // Add the "condition" and "check_type" entries described by site, materialized on first
+        // read. site must have static storage duration.
+        auto set(throw_site const & site) -> void;
+
+        // Append a context frame. Allocates only if this handle has no block yet; copies the
+        // block if another handle shares it.
+        auto add_frame(context_frame const & frame) -> void;
+
+        // Context frames in the order they were added, and the number that did not fit.
+        [[nodiscard]] auto frames() const noexcept -> std::span<context_frame const>;
+        [[nodiscard]] auto dropped_frames() const noexcept -> std::size_t {
+            return m_storage == nullptr ? 0 : m_storage->m_frames_dropped;
+        }
+
+        // Returns end() if key is not present.
+        [[nodiscard]] auto find(std::string_view key) const -> const_iterator;
+        [[nodiscard]] auto contains(std::string_view key) const -> bool;
+
+        [[nodiscard]] auto begin() const -> const_iterator;
+        [[nodiscard]] auto end() const noexcept -> const_iterator {
+            return m_storage == nullptr ? nullptr : m_storage->m_begin + m_storage->m_size;
+        }
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return m_storage == nullptr ? 0 : m_storage->m_size;
+        }
+        [[nodiscard]] auto empty() const noexcept -> bool { return size() == 0; }
+
+        // True if this handle and other refer to the same block.
+        [[nodiscard]] auto shares_with(exception_data const & other) const noexcept -> bool {
+            return m_storage != nullptr && m_storage == other.m_storage;
+        }
+
+    private:
+        // The block, unshared: allocated if absent, copied if another handle refers to it.
+        auto writable() -> detail::exception_storage &;
+        auto release() noexcept -> void;
+
+        detail::exception_storage * m_storage {nullptr};
+    };
+
+}  // namespace hinder
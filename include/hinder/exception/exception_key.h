@@ -0,0 +1,128 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <string_view>
+#include <type_traits>
+
+namespace hinder {
+
+    class exception_key;
+
+    namespace detail {
+
+        template <typename S>
+        concept key_source = std::convertible_to<S, std::string_view>
+                             && !std::same_as<std::remove_cvref_t<S>, exception_key>;
+
+    }  // namespace detail
+
+    //
+    // Key for exception and error key-value data.
+    //
+    // Every key is copied, so it cannot dangle whatever storage it came from. Nearly every key is
+    // short ("message", "condition", "path"); keys of up to inline_capacity characters are stored
+    // inside the key itself and cost no allocation. Longer keys are copied to the heap.
+    //
+    // Example:
+    //   exc.with("path", filename);           // short: stored inline
+    //   exc.with(std::string(name), value);   // any string-like key works the same way
+    //
+    class exception_key {
+    public:
+        static constexpr std::size_t inline_capacity = 16;
+
+        // NOLINTBEGIN(hicpp-explicit-conversions): keys convert implicitly at every with() call
+        template <typename S>
+            requires detail::key_source<S>
+        exception_key(S && key) {
+            assign(std::string_view(key));
+        }
+
+        operator std::string_view() const noexcept { return view(); }
+        // NOLINTEND(hicpp-explicit-conversions)
+
+        ~exception_key();
+        exception_key(exception_key const & other);
+        auto operator=(exception_key const & other) -> exception_key &;
+        exception_key(exception_key && other) noexcept;
+        auto operator=(exception_key && other) noexcept -> exception_key &;
+
+        [[nodiscard]] auto view() const noexcept -> std::string_view {
+            return is_inline() ? std::string_view(m_chars.data(), m_size)
+                               : std::string_view(m_heap, m_size);
+        }
+
+        // True if the key is stored inside the object rather than on the heap.
+        [[nodiscard]] auto is_inline() const noexcept -> bool { return m_size <= inline_capacity; }
+
+        friend auto operator==(exception_key const & lhs, std::string_view rhs) noexcept -> bool {
+            return lhs.view() == rhs;
+        }
+
+        friend auto operator<=>(exception_key const & lhs, std::string_view rhs) noexcept
+            -> std::strong_ordering {
+            return lhs.view() <=> rhs;
+        }
+
+    private:
+        auto assign(std::string_view key) -> void {
+            if (key.size() > inline_capacity) {
+                assign_heap(key);
+                return;
+            }
+            std::ranges::copy(key, m_chars.begin());
+            m_size = key.size();
+        }
+
+        auto assign_heap(std::string_view key) -> void;
+        auto take(exception_key & other) noexcept -> void;
+
+        union {
+            std::array<char, inline_capacity> m_chars {};
+            char const *                      m_heap;
+        };
+        std::size_t m_size {0};
+    };
+
+}  // namespace hinder
+
+// std::format support for hinder::exception_key: formats view() with the std::string_view specs.
+template <>
+struct std::formatter<hinder::exception_key, char> : std::formatter<std::string_view, char> {
+    template <typename FormatContext>
+    auto format(hinder::exception_key const & key, FormatContext & ctx) const
+        -> typename FormatContext::iterator {
+        return std::formatter<std::string_view, char>::format(key.view(), ctx);
+    }
+};
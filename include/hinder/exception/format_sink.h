@@ -0,0 +1,355 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <hinder/exception/context_frame.h>
+#include <hinder/exception/exception_value.h>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace hinder {
+
+    //
+    // Buffered character output for the streaming formatters (to_string_to, to_json_to).
+    //
+    // Text is collected in a fixed buffer inside the sink and handed to the target in chunks, so
+    // formatting makes no allocations of its own. The target sits behind a function pointer,
+    // which keeps the formatters themselves out of line in the library.
+    //
+    // Call flush() when done; the destructor does not.
+    //
+    class format_sink {
+    public:
+        using drain_t = void (*)(void * target, std::string_view text);
+
+        static constexpr std::size_t buffer_size = 256;
+
+        // Drain to an output iterator, advancing out.
+        template <typename Out>
+            requires std::output_iterator<Out, char const &>
+        explicit format_sink(Out & out) noexcept
+        : m_target(std::addressof(out)),
+          m_drain([](void * target, std::string_view text) -> void {
+              auto & iter = *static_cast<Out *>(target);
+              iter        = std::ranges::copy(text, std::move(iter)).out;
+          }) {}
+
+        // Drain by appending to a string.
+        explicit format_sink(std::string & out) noexcept
+        : m_target(std::addressof(out)),
+          m_drain([](void * target, std::string_view text) -> void {
+              static_cast<std::string *>(target)->append(text);
+          }) {}
+
+        // Drain into a fixed buffer, shrinking out to the unused tail. Text that does not fit is
+        // dropped but still counted by written().
+        explicit format_sink(std::span<char> & out) noexcept
+        : m_target(std::addressof(out)),
+          m_drain([](void * target, std::string_view text) -> void {
+              auto &     buffer = *static_cast<std::span<char> *>(target);
+              auto const count  = std::min(text.size(), buffer.size());
+              std::memcpy(buffer.data(), text.data(), count);
+              buffer = buffer.subspan(count);
+          }) {}
+
+        ~format_sink()                                       = default;
+        format_sink(format_sink const &)                     = delete;
+        auto operator=(format_sink const &) -> format_sink & = delete;
+        format_sink(format_sink &&)                          = delete;
+        auto operator=(format_sink &&) -> format_sink &      = delete;
+
+        auto put(char chr) -> void {
+            if (m_size == buffer_size) {
+                flush();
+            }
+            m_buffer[m_size++] = chr;
+        }
+
+        auto write(std::string_view text) -> void {
+            if (text.size() > buffer_size - m_size) {
+                flush();
+                if (text.size() > buffer_size) {
+                    m_written += text.size();
+                    m_drain(m_target, text);
+                    return;
+                }
+            }
+            std::memcpy(m_buffer.data() + m_size, text.data(), text.size());
+            m_size += text.size();
+        }
+
+        // Shortest round-trip form, as std::format("{}", value) writes it.
+        template <typename T>
+            requires std::is_arithmetic_v<T>
+        auto write_number(T value) -> void {
+            std::array<char, 32> digits {};
+            auto const [end, ec] =
+                std::to_chars(digits.data(), digits.data() + digits.size(), value);
+            write({digits.data(), static_cast<std::size_t>(end - digits.data())});
+        }
+
+        // As std::format("{}", ptr) writes it: 0x followed by lowercase hex.
+        auto write_pointer(void const * ptr) -> void {
+            std::array<char, 2 + (2 * sizeof(void *))> digits {'0', 'x'};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            auto const address   = reinterpret_cast<std::uintptr_t>(ptr);
+            auto const [end, ec] = std::to_chars(digits.data() + 2,
+                                                 digits.data() + digits.size(),
+                                                 address,
+                                                 16);
+            write({digits.data(), static_cast<std::size_t>(end - digits.data())});
+        }
+
+        // Hand any buffered text to the target.
+        auto flush() -> void {
+            if (m_size > 0) {
+                m_written += m_size;
+                m_drain(m_target, {m_buffer.data(), m_size});
+                m_size = 0;
+            }
+        }
+
+        // Characters handed to the target so far.
+        [[nodiscard]] auto written() const noexcept -> std::size_t { return m_written; }
+
+    private:
+        void *                        m_target;
+        drain_t                       m_drain;
+        std::size_t                   m_size {0};
+        std::size_t                   m_written {0};
+        std::array<char, buffer_size> m_buffer;
+    };
+
+    namespace detail {
+
+        // Output iterators accepted by to_string_to() and to_json_to(). Raw pointers are left to
+        // the std::span<char> overloads, which know where the buffer ends.
+        template <typename Out>
+        concept format_output = std::output_iterator<Out, char const &> && !std::is_pointer_v<Out>;
+
+        // Shared pieces of the exception and error formatters.
+
+        // A quoted, escaped JSON string.
+        auto write_json_string(format_sink & sink, std::string_view text) -> void;
+
+        // "\n  context:" section of to_string(); nothing if there are no frames.
+        auto write_context_string(format_sink &                  sink,
+                                  std::span<context_frame const> frames,
+                                  std::size_t                    dropped) -> void;
+
+        // ,"context":[...] member of to_json(); nothing if there are no frames.
+        auto write_context_json(format_sink &                  sink,
+                                std::span<context_frame const> frames,
+                                std::size_t                    dropped) -> void;
+
+        // Value is exception_value or error_batch::value_view. A flag is written as nothing.
+        template <typename Value>
+        auto write_value(format_sink & sink, Value const & val) -> void {
+            std::visit(
+                [&sink](auto const & val) -> void {
+                    using T = std::remove_cvref_t<decltype(val)>;
+
+                    // NOLINTNEXTLINE(bugprone-branch-clone)
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        return;
+                    } else if constexpr (std::is_same_v<T, bool>) {
+                        sink.write(val ? "true" : "false");
+                    } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+                        sink.write(val);
+                    } else {
+                        sink.write_number(val);
+                    }
+                },
+                val);
+        }
+
+        // As write_value(), as a JSON value. A flag is written as null.
+        template <typename Value>
+        auto write_json_value(format_sink & sink, Value const & val) -> void {
+            std::visit(
+                [&sink](auto const & val) -> void {
+                    using T = std::remove_cvref_t<decltype(val)>;
+
+                    // NOLINTNEXTLINE(bugprone-branch-clone)
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        sink.write("null");
+                    } else if constexpr (std::is_same_v<T, bool>) {
+                        sink.write(val ? "true" : "false");
+                    } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+                        write_json_string(sink, val);
+                    } else {
+                        sink.write_number(val);
+                    }
+                },
+                val);
+        }
+
+        // As write_value(), with strings quoted and escaped as in JSON so that the compact format
+        // stays on one line.
+        template <typename Value>
+        auto write_compact_value(format_sink & sink, Value const & val) -> void {
+            std::visit(
+                [&sink](auto const & val) -> void {
+                    using T = std::remove_cvref_t<decltype(val)>;
+
+                    // NOLINTNEXTLINE(bugprone-branch-clone)
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        return;
+                    } else if constexpr (std::is_same_v<T, bool>) {
+                        sink.write(val ? "true" : "false");
+                    } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+                        write_json_string(sink, val);
+                    } else {
+                        sink.write_number(val);
+                    }
+                },
+                val);
+        }
+
+        // True if to_string() shows the key alone: a flag, or an empty string.
+        template <typename Value>
+        auto is_bare_key(Value const & val) -> bool {
+            return std::visit(
+                [](auto const & val) -> bool {
+                    using T = std::remove_cvref_t<decltype(val)>;
+
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        return true;
+                    } else if constexpr (std::is_convertible_v<T, std::string_view>) {
+                        return std::string_view(val).empty();
+                    } else {
+                        return false;
+                    }
+                },
+                val);
+        }
+
+        // ====================================================================
+        // std::formatter support
+        // ====================================================================
+
+        enum class format_style : std::uint8_t {
+            human,    // to_string()
+            json,     // to_json()
+            compact,  // one line: type @file:line key=value ...
+        };
+
+        //
+        // Parses the spec shared by hinder's std::formatter specializations: empty or 'h' for
+        // human-readable, 'j' for JSON, 'c' for compact. Anything else is a std::format_error,
+        // reported at compile time for a constant format string.
+        //
+        struct style_parser {
+            format_style style {format_style::human};
+
+            constexpr auto parse(std::format_parse_context & ctx)
+                -> std::format_parse_context::iterator {
+                auto iter = ctx.begin();
+                if (iter != ctx.end() && *iter != '}') {
+                    switch (*iter) {
+                    case 'h':
+                        style = format_style::human;
+                        break;
+                    case 'j':
+                        style = format_style::json;
+                        break;
+                    case 'c':
+                        style = format_style::compact;
+                        break;
+                    default:
+                        bad_spec();
+                    }
+                    ++iter;
+                }
+                if (iter != ctx.end() && *iter != '}') {
+                    bad_spec();
+                }
+                return iter;
+            }
+
+            [[noreturn]] static auto bad_spec() -> void {
+#if defined(__cpp_exceptions)
+                throw std::format_error("hinder: format spec must be empty, h, j or c");
+#else
+                std::abort();
+#endif
+            }
+        };
+
+    }  // namespace detail
+
+    //
+    // Makes an exception_value formattable: "{}" or "{:h}" as value_to_string() writes it, "{:j}"
+    // as a JSON value, "{:c}" with strings quoted. std::formatter cannot be specialized for
+    // exception_value itself, which is a std::variant of standard types.
+    //
+    // Example:
+    //   std::format("{}={:j}", key.view(), hinder::formatted_value {value});
+    //
+    struct formatted_value {
+        exception_value const & value;
+    };
+
+}  // namespace hinder
+
+template <>
+struct std::formatter<hinder::formatted_value, char> : hinder::detail::style_parser {
+    template <typename FormatContext>
+    auto format(hinder::formatted_value const & val, FormatContext & ctx) const
+        -> typename FormatContext::iterator {
+        auto                out = ctx.out();
+        hinder::format_sink sink(out);
+        switch (style) {
+        case hinder::detail::format_style::human:
+            hinder::detail::write_value(sink, val.value);
+            break;
+        case hinder::detail::format_style::json:
+            hinder::detail::write_json_value(sink, val.value);
+            break;
+        case hinder::detail::format_style::compact:
+            hinder::detail::write_compact_value(sink, val.value);
+            break;
+        }
+        sink.flush();
+        return out;
+    }
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <expected>
+#include <hinder/exception/error_record.h>
+#include <string_view>
+
+namespace hinder {
+
+    //
+    // Parse one object written by to_json(exception const&) or to_json(error const&), in a
+    // single pass over the text.
+    //
+    // The parser knows the schema: "type" (required), "source" and "data". Other members such as
+    // "context" and "stack" are skipped, as is whitespace, so pretty-printed or reordered output
+    // is accepted. Strings without escapes are read in place and copied once, into the record.
+    //
+    // Values map back as follows: strings, booleans and null (a flag) exactly; integers to
+    // int64_t, or uint64_t if too large; other numbers to double. A value written as a uint64_t
+    // that fits an int64_t therefore comes back as int64_t, and a whole double as an integer.
+    //
+    // Example:
+    //   auto const record = hinder::parse_json_record(line);
+    //   if (record) {
+    //       std::println("{} at {}:{}", record->type_name, record->file, record->line);
+    //   }
+    //
+    [[nodiscard]] auto parse_json_record(std::string_view json)
+        -> std::expected<error_record, record_parse_error>;
+
+}  // namespace hinder
@@ -0,0 +1,82 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstdint>
+#include <source_location>
+
+namespace hinder {
+
+    //
+    // Throw-site location stored by hinder::exception and hinder::error.
+    //
+    // Controlled by the HINDER_WITH_EXCEPTION_SOURCE CMake option:
+    // - ON:  wraps the std::source_location captured at the throw site. File names are trimmed
+    //        relative to HINDER_SOURCE_ROOT at compile time (-fmacro-prefix-map), so binaries do
+    //        not embed absolute build paths.
+    // - OFF: an empty type. Nothing is stored, file_name() is "" and line() is 0, and the
+    //        formatters omit the source entirely.
+    //
+    // Either way the type is constructible from std::source_location, so call sites are the same.
+    //
+    class source_info {
+    public:
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+        static constexpr bool enabled = true;
+
+        constexpr source_info() noexcept = default;
+        constexpr explicit source_info(std::source_location loc) noexcept : m_location(loc) {}
+
+        [[nodiscard]] constexpr auto file_name() const noexcept -> char const * {
+            return m_location.file_name();
+        }
+        [[nodiscard]] constexpr auto function_name() const noexcept -> char const * {
+            return m_location.function_name();
+        }
+        [[nodiscard]] constexpr auto line() const noexcept -> std::uint_least32_t {
+            return m_location.line();
+        }
+        [[nodiscard]] constexpr auto column() const noexcept -> std::uint_least32_t {
+            return m_location.column();
+        }
+
+    private:
+        std::source_location m_location;
+#else
+        static constexpr bool enabled = false;
+
+        constexpr source_info() noexcept = default;
+        constexpr explicit source_info(std::source_location /*loc*/) noexcept {}
+
+        [[nodiscard]] static constexpr auto file_name() noexcept -> char const * { return ""; }
+        [[nodiscard]] static constexpr auto function_name() noexcept -> char const * { return ""; }
+        [[nodiscard]] static constexpr auto line() noexcept -> std::uint_least32_t { return 0; }
+        [[nodiscard]] static constexpr auto column() noexcept -> std::uint_least32_t { return 0; }
+#endif
+    };
+
+}  // namespace hinder
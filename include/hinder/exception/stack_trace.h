@@ -0,0 +1,85 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace hinder {
+
+    //
+    // Return addresses of the calling thread's stack, captured without symbolization.
+    //
+    // capture() walks the stack with the unwinder into a fixed inline buffer: no allocation, no
+    // symbol lookup. Resolve names later with symbolize(), which uses dladdr and demangles. That
+    // is slow and allocates, so it is only done when a trace is formatted.
+    //
+    // Symbols resolve only for functions in the dynamic symbol table: shared libraries, and
+    // executables linked with -rdynamic (CMake: ENABLE_EXPORTS). Other frames show the object
+    // file and address. On platforms without an unwinder, capture() returns an empty trace.
+    //
+    // Example:
+    //   auto const trace = hinder::stack_trace::capture();
+    //   for (auto const & frame : trace.symbolize()) {
+    //       std::println("{} {}", frame.address, frame.symbol);
+    //   }
+    //
+    class stack_trace {
+    public:
+        static constexpr std::size_t max_frames = 32;
+
+        // One resolved frame. symbol and object are empty when they cannot be determined.
+        struct frame {
+            void const * address {nullptr};
+            std::string  symbol;  // demangled function name
+            std::string  object;  // path of the executable or shared library
+        };
+
+        stack_trace() noexcept = default;
+
+        // Capture the caller's stack, innermost frame first. skip drops that many further
+        // frames below the caller (e.g. a constructor that captures on its creator's behalf).
+        [[nodiscard]] static auto capture(std::size_t skip = 0) noexcept -> stack_trace;
+
+        [[nodiscard]] auto addresses() const noexcept -> std::span<void * const> {
+            return {m_frames.data(), m_size};
+        }
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+        [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+
+        // Resolve every captured address.
+        [[nodiscard]] auto symbolize() const -> std::vector<frame>;
+
+    private:
+        std::array<void *, max_frames> m_frames {};
+        std::size_t                    m_size {0};
+    };
+
+}  // namespace hinder
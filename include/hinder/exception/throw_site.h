@@ -0,0 +1,52 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+namespace hinder {
+
+    //
+    // Static description of a throw site: the parts of a throw that are the same every time it
+    // executes.
+    //
+    // The contract macros (HINDER_EXPECTS etc.) define one per check as a function-local constant.
+    // An exception thrown from the check stores a pointer to it instead of copies of the strings.
+    // The "condition" and "check_type" entries it describes are materialized on first read, so
+    // throwing, and copying the exception through std::exception_ptr, copy no strings.
+    //
+    // A throw_site must have static storage duration; exceptions keep the pointer for their
+    // whole lifetime.
+    //
+    // Example:
+    //   static constexpr hinder::throw_site site {"ptr != nullptr", "precondition"};
+    //   throw null_pointer_error().with_site(site);
+    //
+    struct throw_site {
+        char const * condition {nullptr};
+        char const * check_type {nullptr};
+    };
+
+}  // namespace hinder
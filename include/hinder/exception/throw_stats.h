@@ -0,0 +1,181 @@
+#pragma once
+
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <hinder/exception/source_info.h>
+#include <optional>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hinder {
+
+    class exception;
+    struct throw_site_stats;
+
+    // ========================================================================
+    // Per-throw-site statistics
+    // ========================================================================
+
+    //
+    // Counter for one HINDER_THROW site.
+    //
+    // When HINDER_WITH_THROW_STATS is defined (CMake option, or per translation unit before
+    // including hinder/exception/exception.h), each HINDER_THROW defines one as a function-local
+    // static. It adds itself to a global lock-free registry on its first throw. Recording a throw
+    // costs three relaxed atomic operations and a clock read.
+    //
+    // Sites in a shared library stay registered for the life of the process, so do not unload
+    // such a library while the registry may still be read.
+    //
+    class throw_site_counter {
+    public:
+        using clock_t = std::chrono::system_clock;
+
+        throw_site_counter(std::string_view type_name, std::source_location loc) noexcept;
+
+        ~throw_site_counter()                                              = default;
+        throw_site_counter(throw_site_counter const &)                     = delete;
+        auto operator=(throw_site_counter const &) -> throw_site_counter & = delete;
+        throw_site_counter(throw_site_counter &&)                          = delete;
+        auto operator=(throw_site_counter &&) -> throw_site_counter &      = delete;
+
+        // Count one throw.
+        auto record() noexcept -> void;
+
+    private:
+        friend auto collect_throw_stats() -> std::vector<throw_site_stats>;
+        friend auto reset_throw_stats() noexcept -> void;
+
+        std::string_view                  m_type_name;
+        [[no_unique_address]] source_info m_location;
+        std::atomic<std::uint64_t>        m_count {0};
+        std::atomic<std::int64_t>         m_first_seen {0};  // clock_t ticks, 0 = never
+        std::atomic<std::int64_t>         m_last_seen {0};
+        throw_site_counter *              m_next {nullptr};  // registry link, immutable once set
+    };
+
+    //
+    // Snapshot of one site's counters.
+    //
+    struct throw_site_stats {
+        using time_point = throw_site_counter::clock_t::time_point;
+
+        std::string_view                  type_name;
+        [[no_unique_address]] source_info location;
+        std::uint64_t                     count {0};
+        time_point                        first_seen;
+        time_point                        last_seen;
+    };
+
+    //
+    // Snapshot every registered site that has thrown, most frequent first. Lock-free: may run
+    // concurrently with throws, in which case counts are as of some moment during the call.
+    //
+    [[nodiscard]] auto collect_throw_stats() -> std::vector<throw_site_stats>;
+
+    //
+    // Zero every site's counters. Sites stay registered.
+    //
+    auto reset_throw_stats() noexcept -> void;
+
+    //
+    // JSON array for structured logging, one object per site.
+    //
+    // Example output:
+    //   [{"type":"file_error","source":{"file":"src/io.cpp","line":42},"count":1207,
+    //     "first_seen_ns":1760000000000000000,"last_seen_ns":1760000004000000000}]
+    //
+    [[nodiscard]] auto to_json(std::span<throw_site_stats const> stats) -> std::string;
+
+    // ========================================================================
+    // Rate-limited reporting
+    // ========================================================================
+
+    //
+    // Deduplicates exception logging by throw site, so a throw storm cannot flood a log.
+    //
+    // admit() lets the first exception from a site through, then at most one per interval.
+    // Suppressed ones are only counted, and the count is handed to the next admitted one.
+    // A site is identified by its static throw_site when the exception has one (as contract checks
+    // do), otherwise by type name and source location. Each site may use either of two slots out
+    // of slot_count; only when both are held by other sites is the one admitted least recently
+    // taken over, which can only admit more, never hide a site for long.
+    //
+    // Thread safety: admit() is lock-free and may be called concurrently.
+    //
+    // Example:
+    //   static hinder::log_throttle throttle {std::chrono::seconds(10)};
+    //
+    //   catch (hinder::exception const & exc) {
+    //       if (auto suppressed = throttle.admit(exc)) {
+    //           log(hinder::to_json(exc), *suppressed);
+    //       }
+    //   }
+    //
+    class log_throttle {
+    public:
+        using clock_t    = std::chrono::steady_clock;
+        using duration_t = clock_t::duration;
+
+        static constexpr std::size_t slot_count = 256;
+
+        explicit log_throttle(duration_t interval = std::chrono::seconds(1)) noexcept
+        : m_interval(interval) {}
+
+        // nullopt: suppress this one. Otherwise: log it; the value is how many were suppressed
+        // from the same site since the last one admitted.
+        [[nodiscard]] auto admit(exception const & exc) noexcept -> std::optional<std::uint64_t>;
+
+    private:
+        struct slot_t;
+
+        // Restart slot for the site that just took it, admitting this exception.
+        static auto claim(slot_t & slot, std::int64_t next) noexcept
+            -> std::optional<std::uint64_t>;
+
+        // Admit or suppress an exception from the site slot already tracks.
+        static auto throttle(slot_t & slot, std::int64_t now, std::int64_t next) noexcept
+            -> std::optional<std::uint64_t>;
+
+        struct slot_t {
+            std::atomic<std::uint64_t> site {0};
+            std::atomic<std::int64_t>  next_admit {0};  // clock_t ticks
+            std::atomic<std::uint64_t> suppressed {0};
+        };
+
+        duration_t                     m_interval;
+        std::array<slot_t, slot_count> m_slots {};
+    };
+
+}  // namespace hinder
@@ -0,0 +1,149 @@
+#pragma once
+
+//
+// hinder::error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <expected>
+#include <functional>
+#include <hinder/compiler.h>
+#include <hinder/exception/exception.h>
+#include <hinder/expected/error.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace hinder {
+
+    // ========================================================================
+    // Bridging between hinder::exception and std::expected<T, hinder::error>
+    // ========================================================================
+
+    //
+    // Thrown by value_or_throw() for an expected that holds an error.
+    //
+    // Carries the error's type name, location, and payload: type_name() is the error's type
+    // name, not "error_exception", and to_error() gives back an equal error. Catch it as
+    // error_exception, generic_error, or exception. The type name is owned by the exception and
+    // shared between its copies, so names from decoded errors do not outlive it.
+    //
+    class error_exception : public exception_crtp<error_exception, generic_error> {
+    public:
+        static constexpr std::string_view static_type_name {"error_exception"};
+
+        explicit error_exception(error const & err);
+
+        // Copy only, so that a moved-from exception still owns the name its type_name() refers to
+        ~error_exception() override                                  = default;
+        error_exception(error_exception const &)                     = default;
+        auto operator=(error_exception const &) -> error_exception & = default;
+
+    private:
+        std::shared_ptr<std::string const> m_type_name;  // type_name() points into this
+    };
+
+    //
+    // Convert an exception to an error with the same type name, location, and payload.
+    //
+    // The payload is shared with the exception, not copied: the error's keys and values are the
+    // exception's until either side is modified (see hinder::exception_data).
+    //
+    [[nodiscard]] auto to_error(exception const & exc) -> error;
+
+    //
+    // Throw error_exception for err. Cold and never inlined, so value_or_throw() adds one
+    // predicted branch to the caller.
+    //
+    [[noreturn]] HINDER_COLD HINDER_NOINLINE auto throw_error(error const & err) -> void;
+
+    namespace detail {
+
+        template <typename T>
+        inline constexpr bool is_error_expected_v = false;
+
+        template <typename T>
+        inline constexpr bool is_error_expected_v<std::expected<T, error>> = true;
+
+        template <typename T>
+        concept error_expected = is_error_expected_v<std::remove_cvref_t<T>>;
+
+        // A reference into an lvalue expected, or the value itself for an rvalue one, so that the
+        // result of value_or_throw(f()) does not refer to a destroyed temporary.
+        template <typename Expected>
+        using value_or_throw_t =
+            std::conditional_t<std::is_lvalue_reference_v<Expected>,
+                               decltype(*std::declval<Expected>()),
+                               typename std::remove_cvref_t<Expected>::value_type>;
+
+    }  // namespace detail
+
+    //
+    // Call fn and return its result as std::expected<R, error>, where R is fn's result without
+    // reference or cv qualifiers. A hinder::exception thrown by fn becomes the error (see
+    // to_error()); any other exception propagates.
+    //
+    // Example:
+    //   auto const config = hinder::catch_as_expected([&] { return vendor::load(path); });
+    //   if (!config) {
+    //       log(hinder::to_json(config.error()));
+    //   }
+    //
+    template <typename Fn>
+    [[nodiscard]] auto catch_as_expected(Fn && fn)
+        -> std::expected<std::remove_cvref_t<std::invoke_result_t<Fn>>, error> {
+        try {
+            if constexpr (std::is_void_v<std::invoke_result_t<Fn>>) {
+                std::invoke(std::forward<Fn>(fn));
+                return {};
+            } else {
+                return std::invoke(std::forward<Fn>(fn));
+            }
+        } catch (exception const & exc) {
+            return std::unexpected(to_error(exc));
+        }
+    }
+
+    //
+    // The value held by exp, or throw error_exception with its error.
+    //
+    // Like exp.value(), but throws a hinder::exception carrying the error's type name, location,
+    // and payload instead of std::bad_expected_access. An lvalue exp gives a reference to its
+    // value; an rvalue exp gives the value moved out, which is safe to keep.
+    //
+    // Example:
+    //   auto   row  = hinder::value_or_throw(cache.lookup(key));   // moved out of the temporary
+    //   auto & last = hinder::value_or_throw(m_last);              // refers into m_last
+    //
+    template <detail::error_expected Expected>
+    auto value_or_throw(Expected && exp) -> detail::value_or_throw_t<Expected> {
+        if (!exp.has_value()) [[unlikely]] {
+            throw_error(exp.error());
+        }
+        return *std::forward<Expected>(exp);
+    }
+
+}  // namespace hinder
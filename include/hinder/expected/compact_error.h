@@ -0,0 +1,137 @@
+#pragma once
+
+//
+// hinder::error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstdint>
+#include <hinder/compiler.h>
+#include <hinder/exception/source_info.h>
+#include <hinder/expected/error.h>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+namespace hinder {
+
+    // ========================================================================
+    // error_descriptor: static description of an error that carries no data
+    // ========================================================================
+
+    //
+    // Type name, message and location of an error that is the same every time it is returned.
+    // Declare one with static storage duration where the error is raised; the location defaults
+    // to the point of declaration.
+    //
+    // Example:
+    //   static constexpr hinder::error_descriptor not_found {"lookup_error", "key not found"};
+    //
+    struct error_descriptor {
+        constexpr error_descriptor(std::string_view     type_name,
+                                   std::string_view     message = {},
+                                   std::source_location loc = std::source_location::current())
+        : type_name(type_name),
+          message(message),
+          location(loc) {}
+
+        std::string_view                  type_name;
+        std::string_view                  message;  // empty: no "message" key
+        [[no_unique_address]] source_info location;
+    };
+
+    // ========================================================================
+    // compact_error: pointer-sized error handle for hot std::expected paths
+    // ========================================================================
+
+    //
+    // A one-word error for use as E in std::expected<T, E> on functions that rarely fail.
+    //
+    // Refers either to a static error_descriptor (no allocation, nothing to release) or to a
+    // reference-counted heap copy of a full hinder::error. Both convert losslessly to
+    // hinder::error, and any hinder::error converts to a compact_error. So
+    // sizeof(std::expected<int, compact_error>) is two words, where std::expected<int, error>
+    // carries the whole error.
+    //
+    // Copying a heap-backed handle is one atomic increment, so the type is not trivially
+    // copyable. On Clang it is marked HINDER_TRIVIAL_ABI and still passes in registers.
+    //
+    // Example:
+    //   static constexpr hinder::error_descriptor not_found {"lookup_error", "key not found"};
+    //
+    //   auto lookup(int key) -> std::expected<int, hinder::compact_error> {
+    //       if (auto iter = table.find(key); iter != table.end()) {
+    //           return iter->second;
+    //       }
+    //       return std::unexpected(hinder::compact_error(not_found));
+    //   }
+    //
+    class HINDER_TRIVIAL_ABI compact_error {
+    public:
+        // Refer to a static descriptor. desc must have static storage duration.
+        explicit compact_error(error_descriptor const & desc) noexcept;
+
+        // Take a full error; allocates one block.
+        explicit compact_error(error err);
+
+        ~compact_error();
+        compact_error(compact_error const & other) noexcept;
+        auto operator=(compact_error const & other) noexcept -> compact_error &;
+        compact_error(compact_error && other) noexcept;
+        auto operator=(compact_error && other) noexcept -> compact_error &;
+
+        // True if the handle refers to a static descriptor rather than a heap error.
+        [[nodiscard]] auto is_static() const noexcept -> bool { return (m_bits & heap_tag) == 0; }
+
+        [[nodiscard]] auto type_name() const noexcept -> std::string_view;
+        [[nodiscard]] auto location() const noexcept -> source_info const &;
+
+        // The full error: built from the descriptor, or a (shared) copy of the heap error.
+        [[nodiscard]] auto to_error() const -> error;
+
+        // NOLINTNEXTLINE(hicpp-explicit-conversions): lossless widening, like std::string_view
+        operator error() const { return to_error(); }
+
+    private:
+        struct block;
+
+        static constexpr std::uintptr_t heap_tag = 1;
+
+        [[nodiscard]] auto descriptor() const noexcept -> error_descriptor const *;
+        [[nodiscard]] auto heap() const noexcept -> block *;
+        auto               release() noexcept -> void;
+
+        // Tagged pointer: an error_descriptor const *, or a block * with the low bit set.
+        std::uintptr_t m_bits;
+    };
+
+    static_assert(sizeof(compact_error) == sizeof(void *));
+
+    //
+    // Same output as to_string(error const&) and to_json(error const&).
+    //
+    [[nodiscard]] auto to_string(compact_error const & err) -> std::string;
+    [[nodiscard]] auto to_json(compact_error const & err) -> std::string;
+
+}  // namespace hinder
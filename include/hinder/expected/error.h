@@ -26,14 +26,24 @@
 // SOFTWARE.
 //
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <expected>
 #include <format>
-#include <functional>
+#include <hinder/compiler.h>
+#include <hinder/exception/binary.h>
+#include <hinder/exception/context_frame.h>
+#include <hinder/exception/deferred_message.h>
+#include <hinder/exception/exception_data.h>
+#include <hinder/exception/exception_key.h>
 #include <hinder/exception/exception_value.h>
-#include <map>
+#include <hinder/exception/format_sink.h>
+#include <hinder/exception/source_info.h>
+#include <memory>
 #include <optional>
 #include <source_location>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -42,6 +52,32 @@
 
 namespace hinder {
 
+    namespace detail {
+
+        //
+        // An error's type name. Names of up to inline_capacity characters are stored in place, as
+        // a short std::string would be; longer names are held in a string shared between copies.
+        // Copying never allocates.
+        //
+        class error_type_name {
+        public:
+            static constexpr std::size_t inline_capacity = 15;
+
+            explicit error_type_name(std::string_view name);
+
+            [[nodiscard]] auto view() const noexcept -> std::string_view {
+                return m_shared ? std::string_view(*m_shared)
+                                : std::string_view(m_inline.data(), m_size);
+            }
+
+        private:
+            std::shared_ptr<std::string const> m_shared;  // null if the name is stored in place
+            std::array<char, inline_capacity>  m_inline {};
+            std::uint8_t                       m_size {0};
+        };
+
+    }  // namespace detail
+
     // ========================================================================
     // error: value-type analog of hinder::exception for std::expected
     // ========================================================================
@@ -59,29 +95,39 @@ namespace hinder {
     //
     class error {
     public:
-        using data_map       = std::map<std::string, exception_value, std::less<>>;
+        using data_map       = exception_data;
         using const_iterator = data_map::const_iterator;
 
         explicit error(std::string_view     type_name = "error",
                        std::source_location loc       = std::source_location::current());
+        error(std::string_view type_name, source_info loc);
+
+        // Adopt an existing payload, e.g. a hinder::exception's data(). The payload is shared,
+        // not copied.
+        error(std::string_view type_name, source_info loc, data_map data);
 
         // Fluent API — mirrors hinder::exception
         template <typename T>
-        auto with(std::string_view key, T && value) -> error & {
-            m_data[std::string(key)] = detail::to_exception_value(std::forward<T>(value));
+        auto with(exception_key key, T && value) -> error & {
+            m_data.set(std::move(key), detail::to_exception_value(std::forward<T>(value)));
             return *this;
         }
 
         // Flag-style with (key exists, no value)
-        auto with(std::string_view key) -> error &;
+        auto with(exception_key key) -> error &;
 
-        // Convenience for the common "message" key
+        // Convenience for the common "message" key. fmt must have static storage duration.
         template <typename... Args>
         auto message(std::format_string<Args...> fmt, Args &&... args) -> error & {
-            m_data["message"] = std::format(fmt, std::forward<Args>(args)...);
+            m_data.set("message", detail::make_message<Args...>(fmt, std::forward<Args>(args)...));
             return *this;
         }
 
+        // Record that the error passed through loc (see hinder::context_frame). HINDER_TRY calls
+        // this on each error it propagates. note must have static storage duration.
+        auto with_frame(char const *         note = nullptr,
+                        std::source_location loc  = std::source_location::current()) -> error &;
+
         // Accessors — mirrors hinder::exception
         [[nodiscard]] auto get(std::string_view key) const -> std::optional<exception_value>;
         [[nodiscard]] auto contains(std::string_view key) const -> bool;
@@ -89,19 +135,41 @@ namespace hinder {
         template <typename T>
         [[nodiscard]] auto get_as(std::string_view key) const -> std::optional<T>;
 
+        // Non-copying access — mirrors hinder::exception
+        [[nodiscard]] auto get_ref(std::string_view key) const -> exception_value const *;
+
+        template <typename Fn>
+        auto visit(std::string_view key, Fn && fn) const -> bool {
+            auto const * val = get_ref(key);
+            if (val == nullptr) {
+                return false;
+            }
+            std::visit(std::forward<Fn>(fn), *val);
+            return true;
+        }
+
         // Iteration over all key-value pairs
         [[nodiscard]] auto begin() const -> const_iterator;
         [[nodiscard]] auto end() const -> const_iterator;
         [[nodiscard]] auto size() const -> std::size_t;
 
+        // The whole key-value payload. A copy shares storage with this error until either is
+        // modified.
+        [[nodiscard]] auto data() const noexcept -> data_map const &;
+
+        // Context frames added by with_frame(), innermost first, and the number that did not
+        // fit (see exception_data::frame_capacity).
+        [[nodiscard]] auto frames() const noexcept -> std::span<context_frame const>;
+        [[nodiscard]] auto dropped_frames() const noexcept -> std::size_t;
+
         // Metadata
         [[nodiscard]] auto type_name() const -> std::string_view;
-        [[nodiscard]] auto location() const -> std::source_location const &;
+        [[nodiscard]] auto location() const -> source_info const &;
 
     private:
-        std::string          m_type_name;
-        std::source_location m_location;
-        data_map             m_data;
+        detail::error_type_name           m_type_name;
+        [[no_unique_address]] source_info m_location;  // empty unless HINDER_WITH_EXCEPTION_SOURCE
+        data_map                          m_data;
     };
 
     // ========================================================================
@@ -123,13 +191,13 @@ namespace hinder {
         explicit error_builder(error err) noexcept : m_error(std::move(err)) {}
 
         template <typename T>
-        auto with(std::string_view key, T && value) -> error_builder & {
-            m_error.with(key, std::forward<T>(value));
+        auto with(exception_key key, T && value) -> error_builder & {
+            m_error.with(std::move(key), std::forward<T>(value));
             return *this;
         }
 
-        auto with(std::string_view key) -> error_builder & {
-            m_error.with(key);
+        auto with(exception_key key) -> error_builder & {
+            m_error.with(std::move(key));
             return *this;
         }
 
@@ -191,6 +259,98 @@ namespace hinder {
     //
     [[nodiscard]] auto to_json(error const & err) -> std::string;
 
+    //
+    // Streaming variants, as for hinder::exception: write to an output iterator and return the
+    // advanced iterator, or into a fixed buffer and return the length of the full output.
+    //
+    template <detail::format_output Out>
+    auto to_string_to(Out out, error const & err) -> Out;
+
+    template <detail::format_output Out>
+    auto to_json_to(Out out, error const & err) -> Out;
+
+    auto to_string_to(std::span<char> buffer, error const & err) -> std::size_t;
+    auto to_json_to(std::span<char> buffer, error const & err) -> std::size_t;
+
+    //
+    // Parse the output of to_json() back into an error: type name and key-value data, as
+    // described for parse_json_record(). The error's location cannot be restored, since a
+    // std::source_location cannot be built from a file and line; use parse_json_record() to
+    // read those. Malformed input yields a "json_error" with a message and the byte "offset".
+    //
+    // Example:
+    //   auto const err = hinder::error_from_json(line);
+    //   if (err && err->type_name() == "validation_error") { ... }
+    //
+    [[nodiscard]] auto error_from_json(std::string_view json) -> std::expected<error, error>;
+
+    //
+    // Binary records, as for hinder::exception (see binary.h): to_binary() returns one,
+    // to_binary_to() streams it, and error_from_binary() reads one back with the same limits as
+    // error_from_json(). Malformed input yields a "binary_error" with a message and the byte
+    // "offset".
+    //
+    [[nodiscard]] auto to_binary(error const & err, key_dictionary const * dict = nullptr)
+        -> std::string;
+
+    template <detail::format_output Out>
+    auto to_binary_to(Out out, error const & err, key_dictionary const * dict = nullptr) -> Out;
+
+    auto to_binary_to(std::span<char>        buffer,
+                      error const &          err,
+                      key_dictionary const * dict = nullptr) -> std::size_t;
+
+    [[nodiscard]] auto error_from_binary(std::string_view       bytes,
+                                         key_dictionary const * dict = nullptr)
+        -> std::expected<error, error>;
+
+    namespace detail {
+
+        //
+        // HINDER_TRY failure path: add the frame and hand the error to the caller. An error from
+        // a temporary is moved, so its payload handle moves up each level; one from an lvalue
+        // is copied, leaving the original unchanged.
+        //
+        [[nodiscard]] HINDER_COLD inline auto propagate(error                err,
+                                                        std::source_location loc,
+                                                        char const *         note = nullptr)
+            -> std::unexpected<error> {
+            err.with_frame(note, loc);
+            return std::unexpected<error>(std::move(err));
+        }
+
+        auto write_string(format_sink & sink, error const & err) -> void;
+        auto write_json(format_sink & sink, error const & err) -> void;
+        auto write_compact(format_sink & sink, error const & err) -> void;
+        auto write_binary(format_sink & sink, error const & err, key_dictionary const * dict)
+            -> void;
+
+    }  // namespace detail
+
+    template <detail::format_output Out>
+    auto to_string_to(Out out, error const & err) -> Out {
+        format_sink sink(out);
+        detail::write_string(sink, err);
+        sink.flush();
+        return out;
+    }
+
+    template <detail::format_output Out>
+    auto to_json_to(Out out, error const & err) -> Out {
+        format_sink sink(out);
+        detail::write_json(sink, err);
+        sink.flush();
+        return out;
+    }
+
+    template <detail::format_output Out>
+    auto to_binary_to(Out out, error const & err, key_dictionary const * dict) -> Out {
+        format_sink sink(out);
+        detail::write_binary(sink, err, dict);
+        sink.flush();
+        return out;
+    }
+
     // ========================================================================
     // get_as implementation (needs full error definition)
     // ========================================================================
@@ -211,6 +371,12 @@ namespace hinder {
                     return std::nullopt;
                 } else if constexpr (std::is_same_v<T, val_type>) {
                     return val;
+                } else if constexpr (std::is_same_v<T, std::string_view>) {
+                    if constexpr (std::is_same_v<val_type, std::string>) {
+                        return std::string_view(val);
+                    } else {
+                        return std::nullopt;
+                    }
                 } else if constexpr (std::is_same_v<T, std::string>) {
                     return value_to_string(val);
                 } else if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<val_type>) {
@@ -224,6 +390,36 @@ namespace hinder {
 
 }  // namespace hinder
 
+//
+// std::format support for hinder::error, with the specs of std::formatter<hinder::exception>:
+// {} or {:h} as to_string(), {:j} as to_json(), {:c} on one line.
+//
+// Example:
+//   std::format_to(std::back_inserter(line), "{:j}", result.error());
+//
+template <>
+struct std::formatter<hinder::error, char> : hinder::detail::style_parser {
+    template <typename FormatContext>
+    auto format(hinder::error const & err, FormatContext & ctx) const
+        -> typename FormatContext::iterator {
+        auto                out = ctx.out();
+        hinder::format_sink sink(out);
+        switch (style) {
+        case hinder::detail::format_style::human:
+            hinder::detail::write_string(sink, err);
+            break;
+        case hinder::detail::format_style::json:
+            hinder::detail::write_json(sink, err);
+            break;
+        case hinder::detail::format_style::compact:
+            hinder::detail::write_compact(sink, err);
+            break;
+        }
+        sink.flush();
+        return out;
+    }
+};
+
 //
 // Return an error with a type name and formatted message in one expression.
 //
@@ -245,3 +441,39 @@ namespace hinder {
 #define HINDER_FAIL(type, fmt, ...) hinder::fail(type).message(fmt __VA_OPT__(, ) __VA_ARGS__)
 // NOLINTEND(cppcoreguidelines-macro-usage)
 
+
+//
+// Unwrap a std::expected<T, hinder::error>, or return its error from the enclosing function.
+//
+// A statement-expression (GCC and Clang): yields the value if expr holds one. Otherwise it moves
+// the error out (copies it if expr is an lvalue), appends a context frame (this location plus the
+// optional note), and returns it as std::unexpected<hinder::error>. The enclosing function must
+// return a std::expected<U, hinder::error> for some U. The first frame allocates the payload's
+// frame array; later frames do not allocate until its capacity is reached, and no propagation
+// step copies keys or values.
+//
+// Parameters:
+//   expr   Expression yielding std::expected<T, hinder::error>.
+//   note   String literal describing the step (optional).
+//
+// Examples:
+//   auto load(std::string_view path) -> std::expected<config, hinder::error> {
+//       auto text = HINDER_TRY(read_file(path), "reading config");
+//       return HINDER_TRY(parse_config(text));
+//   }
+//
+// NOLINTBEGIN(cppcoreguidelines-macro-usage): must return from the enclosing function
+#if defined(__GNUC__) || defined(__clang__)
+    #define HINDER_TRY(expr, ...)                                                          \
+        __extension__({                                                                    \
+            auto && hinder_try_result = (expr);                                            \
+            using hinder_try_type     = decltype(hinder_try_result);                       \
+            if (!hinder_try_result.has_value()) [[unlikely]] {                             \
+                return ::hinder::detail::propagate(                                        \
+                    std::forward<hinder_try_type>(hinder_try_result).error(),              \
+                    std::source_location::current() __VA_OPT__(, ) __VA_ARGS__);           \
+            }                                                                              \
+            *std::forward<hinder_try_type>(hinder_try_result);                             \
+        })
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
@@ -0,0 +1,358 @@
+#pragma once
+
+//
+// hinder::error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <hinder/exception/exception.h>
+#include <hinder/exception/exception_value.h>
+#include <hinder/exception/source_info.h>
+#include <hinder/expected/error.h>
+#include <iterator>
+#include <optional>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace hinder {
+
+    // Exception type for error_batch misuse (e.g., building a row after the next was added).
+    HINDER_DEFINE_EXCEPTION(error_batch_error, generic_error);
+
+    // ========================================================================
+    // error_batch: column-wise storage for many errors
+    // ========================================================================
+
+    //
+    // Append-only collection of errors stored column-wise, for workloads that produce errors in
+    // bulk (e.g. validating millions of records).
+    //
+    // Type names and keys are interned in a dictionary shared by every row, so each distinct
+    // string is stored once and a row refers to it by a 32-bit id. Values are kept in typed
+    // columns (integers, floating point, and one arena for all string bytes) rather than in
+    // per-error variants. A row costs its type id, location, and offset; an entry costs a key
+    // id, a kind, and a column slot, plus the value itself.
+    //
+    // Each row is available as a row_view with the accessors of hinder::error, or as a full
+    // error via row_view::to_error(). A row's entries are kept sorted by key, the order in which
+    // hinder::error iterates its data. to_json() writes the whole batch as NDJSON.
+    //
+    // Context frames of an appended error are not stored. Not thread-safe.
+    //
+    // Example:
+    //   hinder::error_batch batch;
+    //   for (auto const & record : records) {
+    //       if (record.id == 0) {
+    //           batch.add("validation_error").message("missing id").with("line", record.line);
+    //       }
+    //   }
+    //   std::cout << hinder::to_json(batch);   // one JSON object per line
+    //
+    class error_batch {
+    public:
+        // A stored value. Strings are views into the batch, valid until it is cleared or
+        // destroyed.
+        using value_view = std::variant<std::monostate,  // key exists, no value (flag)
+                                        bool,
+                                        std::int64_t,
+                                        std::uint64_t,
+                                        double,
+                                        std::string_view>;
+
+        class row_view;
+        class row_builder;
+
+        error_batch() = default;
+
+        // Append a row with err's type name, location, and key-value data.
+        // Returns the row index.
+        auto push_back(error const & err) -> std::size_t;
+
+        // Append an empty row and return a builder that adds data to it, without constructing a
+        // hinder::error. Only the most recently added row can be built: a builder used after the
+        // next add() or push_back() throws error_batch_error.
+        auto add(std::string_view     type_name,
+                 std::source_location loc = std::source_location::current()) -> row_builder;
+
+        // Reserve space for rows and entries (key-value pairs across all rows).
+        auto reserve(std::size_t rows, std::size_t entries) -> void;
+
+        // Remove every row. The dictionary is kept, so refilling the batch interns nothing new.
+        auto clear() noexcept -> void;
+
+        [[nodiscard]] auto operator[](std::size_t row) const -> row_view;
+        [[nodiscard]] auto size() const noexcept -> std::size_t { return m_types.size(); }
+        [[nodiscard]] auto empty() const noexcept -> bool { return m_types.empty(); }
+
+        // Key-value pairs across all rows.
+        [[nodiscard]] auto entry_count() const noexcept -> std::size_t { return m_keys.size(); }
+
+        // Distinct type names and keys interned so far.
+        [[nodiscard]] auto dictionary_size() const noexcept -> std::size_t {
+            return m_names.size();
+        }
+
+    private:
+        enum class kind : std::uint8_t { flag, boolean, int64, uint64, real, text };
+
+        struct name_hash {
+            using is_transparent = void;
+
+            auto operator()(std::string_view name) const noexcept -> std::size_t {
+                return std::hash<std::string_view> {}(name);
+            }
+        };
+
+        auto intern(std::string_view name) -> std::uint32_t;
+        auto start_row(std::string_view type_name, source_info loc) -> std::size_t;
+
+        // Add to the last row in key order, overwriting an existing entry with the same key.
+        auto append(std::string_view key, value_view value) -> void;
+        // As append(), for a string just written to the end of m_text.
+        auto append_text(std::string_view key) -> void;
+        auto append_entry(std::uint32_t key, kind knd, std::size_t slot) -> void;
+
+        [[nodiscard]] auto key_at(std::size_t entry) const -> std::string_view {
+            return *m_names[m_keys[entry]];
+        }
+        [[nodiscard]] auto value_at(std::size_t entry) const -> value_view;
+
+        // Dictionary: id -> name, and name -> id. The map's nodes keep the strings in place.
+        std::unordered_map<std::string, std::uint32_t, name_hash, std::equal_to<>> m_ids;
+        std::vector<std::string const *>                                             m_names;
+
+        // Rows. Row r owns entries [m_row_begin[r], m_row_begin[r + 1]).
+        std::vector<std::uint32_t> m_types;
+        std::vector<source_info>   m_locations;
+        std::vector<std::uint32_t> m_row_begin {0};
+
+        // Entries.
+        std::vector<std::uint32_t> m_keys;
+        std::vector<kind>          m_kinds;
+        std::vector<std::uint32_t> m_slots;  // column index; the value itself for flags and bools
+
+        // Value columns. String s is m_text[m_text_begin[s], m_text_begin[s + 1]).
+        std::vector<std::int64_t>  m_ints;
+        std::vector<std::uint64_t> m_uints;
+        std::vector<double>        m_reals;
+        std::string                m_text;
+        std::vector<std::size_t>   m_text_begin {0};
+    };
+
+    //
+    // One row of an error_batch, with the read accessors of hinder::error. Iterates in key order.
+    // Valid until the batch is cleared or destroyed.
+    //
+    class error_batch::row_view {
+    public:
+        struct entry {
+            std::string_view key;
+            value_view       value;
+        };
+
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = entry;
+            using difference_type   = std::ptrdiff_t;
+
+            const_iterator() = default;
+
+            auto operator*() const -> entry {
+                return {m_batch->key_at(m_entry), m_batch->value_at(m_entry)};
+            }
+            auto operator++() -> const_iterator & {
+                ++m_entry;
+                return *this;
+            }
+            auto operator++(int) -> const_iterator {
+                auto copy = *this;
+                ++m_entry;
+                return copy;
+            }
+            auto operator==(const_iterator const & other) const -> bool = default;
+
+        private:
+            friend class row_view;
+
+            const_iterator(error_batch const * batch, std::size_t entry)
+            : m_batch(batch),
+              m_entry(entry) {}
+
+            error_batch const * m_batch {nullptr};
+            std::size_t         m_entry {0};
+        };
+
+        [[nodiscard]] auto type_name() const -> std::string_view;
+        [[nodiscard]] auto location() const -> source_info const &;
+
+        [[nodiscard]] auto get(std::string_view key) const -> std::optional<value_view>;
+        [[nodiscard]] auto contains(std::string_view key) const -> bool;
+
+        // As error::get_as: exact type, std::string (any value, formatted), std::string_view
+        // (strings only), or an arithmetic conversion.
+        template <typename T>
+        [[nodiscard]] auto get_as(std::string_view key) const -> std::optional<T>;
+
+        [[nodiscard]] auto begin() const -> const_iterator { return {m_batch, first()}; }
+        [[nodiscard]] auto end() const -> const_iterator { return {m_batch, last()}; }
+        [[nodiscard]] auto size() const -> std::size_t { return last() - first(); }
+
+        // The row as a standalone error (copies its data).
+        [[nodiscard]] auto to_error() const -> error;
+
+    private:
+        friend class error_batch;
+
+        row_view(error_batch const * batch, std::size_t row) : m_batch(batch), m_row(row) {}
+
+        [[nodiscard]] auto first() const -> std::size_t { return m_batch->m_row_begin[m_row]; }
+        [[nodiscard]] auto last() const -> std::size_t { return m_batch->m_row_begin[m_row + 1]; }
+
+        error_batch const * m_batch;
+        std::size_t         m_row;
+    };
+
+    //
+    // Fluent builder for the row returned by error_batch::add(). Mirrors error's with() and
+    // message(); a message is formatted straight into the batch's string arena.
+    //
+    class error_batch::row_builder {
+    public:
+        template <typename T>
+        auto with(std::string_view key, T const & value) -> row_builder & {
+            using decayed = std::decay_t<T>;
+            check_row();
+
+            // NOLINTNEXTLINE(bugprone-branch-clone)
+            if constexpr (std::is_same_v<decayed, bool>) {
+                m_batch->append(key, value);
+            } else if constexpr (detail::is_string_like_v<T>) {
+                m_batch->append(key, std::string_view(value));
+            } else if constexpr (std::is_floating_point_v<decayed>) {
+                m_batch->append(key, static_cast<double>(value));
+            } else if constexpr (std::is_signed_v<decayed> && std::is_integral_v<decayed>) {
+                m_batch->append(key, static_cast<std::int64_t>(value));
+            } else if constexpr (std::is_unsigned_v<decayed> && std::is_integral_v<decayed>) {
+                m_batch->append(key, static_cast<std::uint64_t>(value));
+            } else {
+                static_assert(std::is_same_v<decayed, void>,
+                              "Unsupported type for with(). "
+                              "Supported types: bool, integers, floating point, strings.");
+            }
+            return *this;
+        }
+
+        // Flag-style with (key exists, no value)
+        auto with(std::string_view key) -> row_builder & {
+            check_row();
+            m_batch->append(key, std::monostate {});
+            return *this;
+        }
+
+        // Convenience for the common "message" key
+        template <typename... Args>
+        auto message(std::format_string<Args...> fmt, Args &&... args) -> row_builder & {
+            check_row();
+            auto const text_size = m_batch->m_text.size();
+            try {
+                std::format_to(
+                    std::back_inserter(m_batch->m_text), fmt, std::forward<Args>(args)...);
+            } catch (...) {
+                // Drop the partial text, which would otherwise prefix the next string.
+                m_batch->m_text.resize(text_size);
+                throw;
+            }
+            m_batch->append_text("message");
+            return *this;
+        }
+
+        // Index of the row being built.
+        [[nodiscard]] auto row() const noexcept -> std::size_t { return m_row; }
+
+    private:
+        friend class error_batch;
+
+        row_builder(error_batch * batch, std::size_t row) : m_batch(batch), m_row(row) {}
+
+        // The batch only adds to its last row, so this builder's row must still be it.
+        auto check_row() const -> void {
+            HINDER_EXPECTS(m_row + 1 == m_batch->size(), error_batch_error);
+        }
+
+        error_batch * m_batch;
+        std::size_t   m_row;
+    };
+
+    //
+    // NDJSON: one line per row, each formatted as to_json(error const&) formats an error.
+    //
+    [[nodiscard]] auto to_json(error_batch const & batch) -> std::string;
+
+    // ========================================================================
+    // get_as implementation (needs full row_view definition)
+    // ========================================================================
+
+    template <typename T>
+    auto error_batch::row_view::get_as(std::string_view key) const -> std::optional<T> {
+        auto const val = get(key);
+        if (!val) {
+            return std::nullopt;
+        }
+
+        return std::visit(
+            [](auto const & val) -> std::optional<T> {
+                using val_type = std::remove_cvref_t<decltype(val)>;
+
+                // NOLINTNEXTLINE(bugprone-branch-clone)
+                if constexpr (std::is_same_v<val_type, std::monostate>) {
+                    return std::nullopt;
+                } else if constexpr (std::is_same_v<T, val_type>) {
+                    return val;
+                } else if constexpr (std::is_same_v<T, std::string>) {
+                    if constexpr (std::is_same_v<val_type, std::string_view>) {
+                        return std::string(val);
+                    } else {
+                        return value_to_string(val);
+                    }
+                } else if constexpr (std::is_arithmetic_v<T> && std::is_arithmetic_v<val_type>) {
+                    return static_cast<T>(val);
+                } else {
+                    return std::nullopt;
+                }
+            },
+            *val);
+    }
+
+}  // namespace hinder
@@ -0,0 +1,238 @@
+#pragma once
+
+//
+// hinder::object_pool
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace hinder {
+
+    // Thread-safe pool that recycles the storage of T objects.
+    //
+    // Intended for payloads handed between threads, e.g. hinder::queue<object_pool<T>::handle>:
+    // a plain std::unique_ptr allocates on the producer and frees on the consumer, which drives
+    // malloc through its slow cross-thread free path on every item. With the pool, released
+    // storage goes to the releasing thread's cache and, once that fills, to a global return list
+    // from which other threads refill their caches in batches. In steady state no allocator
+    // calls are made and the global list lock is taken once per batch, not once per object.
+    //
+    // Capabilities:
+    // - acquire(args...) constructs a T in recycled (or, if none is free, new) storage
+    // - The returned handle is a std::unique_ptr; destroying it destroys the T and returns the
+    //   storage to the pool
+    // - Per-thread caches hold up to thread_cache_size free nodes; half the cache moves to or from
+    //   the global list when it overflows or runs dry
+    //
+    // Requirements:
+    // - The pool must outlive every handle it has produced
+    //
+    // Thread safety: all public operations are thread-safe.
+    template <typename T>
+    class object_pool {
+        struct state;
+
+    public:
+        // Destroys the object and returns its storage to the pool.
+        class deleter {
+        public:
+            deleter() noexcept = default;
+            explicit deleter(state * owner) noexcept : m_owner(owner) {}
+
+            auto operator()(T * ptr) const noexcept -> void {
+                std::destroy_at(ptr);
+                m_owner->release(node::from(ptr));
+            }
+
+        private:
+            state * m_owner {nullptr};
+        };
+
+        using handle = std::unique_ptr<T, deleter>;
+
+        // Default number of free nodes each thread caches.
+        static constexpr std::size_t default_thread_cache_size = 64;
+
+        explicit object_pool(std::size_t thread_cache_size = default_thread_cache_size)
+        : m_state(std::make_shared<state>(std::max<std::size_t>(thread_cache_size, 2))) {}
+
+        ~object_pool()                                      = default;
+        object_pool(object_pool const &)                    = delete;
+        auto operator=(object_pool const &) -> object_pool & = delete;
+        object_pool(object_pool &&)                         = delete;
+        auto operator=(object_pool &&) -> object_pool &     = delete;
+
+        // Construct a T from args in pooled storage.
+        template <typename... Args>
+        [[nodiscard]] auto acquire(Args &&... args) -> handle {
+            node * storage = m_state->take();
+            try {
+                T * obj = std::construct_at(storage->get(), std::forward<Args>(args)...);
+                return handle(obj, deleter(m_state.get()));
+            } catch (...) {
+                m_state->release(storage);
+                throw;
+            }
+        }
+
+        // Number of nodes allocated from the heap over the pool's lifetime. Stays flat once the
+        // pool has warmed up; useful for verifying that a workload is allocation-free.
+        [[nodiscard]] auto allocated() const noexcept -> std::size_t {
+            return m_state->allocated.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // Uninitialized storage for one T.
+        struct node {
+            alignas(T) std::byte storage[sizeof(T)];  // NOLINT(*-avoid-c-arrays)
+
+            auto get() noexcept -> T * {
+                return reinterpret_cast<T *>(storage);  // NOLINT(*-reinterpret-cast)
+            }
+
+            static auto from(T * obj) noexcept -> node * {
+                return reinterpret_cast<node *>(obj);  // NOLINT(*-reinterpret-cast)
+            }
+        };
+
+        // One thread's free nodes for one pool. Returned to the pool when the thread exits, if
+        // the pool is still alive.
+        struct thread_cache {
+            std::weak_ptr<state> owner;
+            state *              raw {nullptr};
+            std::vector<node *>  nodes;
+
+            thread_cache(std::weak_ptr<state> weak, state * ptr, std::size_t capacity)
+            : owner(std::move(weak)),
+              raw(ptr) {
+                nodes.reserve(capacity + 1);
+            }
+
+            ~thread_cache() {
+                if (auto alive = owner.lock()) {
+                    alive->give_back(nodes, nodes.size());
+                }
+            }
+
+            thread_cache(thread_cache const &)                     = delete;
+            auto operator=(thread_cache const &) -> thread_cache & = delete;
+            thread_cache(thread_cache &&)                          = delete;
+            auto operator=(thread_cache &&) -> thread_cache &      = delete;
+        };
+
+        // Shared so that thread caches can detect (via weak_ptr) that the pool is gone.
+        struct state : std::enable_shared_from_this<state> {
+            explicit state(std::size_t capacity) : cache_size(capacity) {}
+
+            ~state() {
+                for (node * storage : all) {
+                    delete storage;  // NOLINT(cppcoreguidelines-owning-memory)
+                }
+            }
+
+            state(state const &)                     = delete;
+            auto operator=(state const &) -> state & = delete;
+            state(state &&)                          = delete;
+            auto operator=(state &&) -> state &      = delete;
+
+            auto take() -> node * {
+                auto & cache = local_cache();
+                if (cache.nodes.empty()) {
+                    std::lock_guard<std::mutex> lck(mutex);
+                    auto const count = std::min(free_list.size(), cache_size / 2);
+                    cache.nodes.insert(cache.nodes.end(), free_list.end() - count, free_list.end());
+                    free_list.resize(free_list.size() - count);
+                }
+                if (!cache.nodes.empty()) {
+                    node * storage = cache.nodes.back();
+                    cache.nodes.pop_back();
+                    return storage;
+                }
+                auto fresh = std::make_unique<node>();
+                {
+                    std::lock_guard<std::mutex> lck(mutex);
+                    free_list.reserve(all.size() + 1);  // so give_back() never allocates
+                    all.push_back(fresh.get());
+                }
+                allocated.fetch_add(1, std::memory_order_relaxed);
+                return fresh.release();
+            }
+
+            auto release(node * storage) noexcept -> void {
+                // The first release on a thread that never acquired creates its cache, which
+                // allocates. If that fails, hand the node straight to the global list instead.
+                thread_cache * cache = nullptr;
+                try {
+                    cache = &local_cache();
+                } catch (...) {
+                    std::lock_guard<std::mutex> lck(mutex);
+                    free_list.push_back(storage);  // reserved for every node: cannot throw
+                    return;
+                }
+                cache->nodes.push_back(storage);  // capacity reserved: cannot throw
+                if (cache->nodes.size() > cache_size) {
+                    give_back(cache->nodes, cache_size / 2);
+                }
+            }
+
+            // Move the last count nodes of nodes to the global free list.
+            auto give_back(std::vector<node *> & nodes, std::size_t count) noexcept -> void {
+                std::lock_guard<std::mutex> lck(mutex);
+                free_list.insert(free_list.end(), nodes.end() - count, nodes.end());
+                nodes.resize(nodes.size() - count);
+            }
+
+            auto local_cache() -> thread_cache & {
+                // One list per thread per T; entries for destroyed pools are pruned lazily.
+                thread_local std::vector<std::unique_ptr<thread_cache>> caches;
+                for (auto & cache : caches) {
+                    if (cache->raw == this && !cache->owner.expired()) {
+                        return *cache;
+                    }
+                }
+                std::erase_if(caches, [](auto const & cache) { return cache->owner.expired(); });
+                caches.push_back(
+                    std::make_unique<thread_cache>(this->weak_from_this(), this, cache_size));
+                return *caches.back();
+            }
+
+            std::size_t const        cache_size;
+            std::atomic<std::size_t> allocated {0};
+            std::mutex               mutex;      // guards free_list and all
+            std::vector<node *>      free_list;  // global return list
+            std::vector<node *>      all;        // every node ever allocated, freed with the pool
+        };
+
+        std::shared_ptr<state> m_state;
+    };
+
+}  // namespace hinder
@@ -25,3 +25,29 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 //
+
+#include <cstddef>
+
+namespace hinder {
+
+    //
+    // Alignment used to keep data written by different threads on separate cache lines.
+    //
+    // std::hardware_destructive_interference_size is not used because GCC warns that its value
+    // depends on -mtune and may differ between translation units.
+    //
+    inline constexpr std::size_t cache_line_size = 64;
+
+    //
+    // Hint to the CPU that the caller is busy-waiting (e.g., PAUSE on x86), reducing power use and
+    // the cost of leaving the spin loop. Compiles to nothing on unknown architectures.
+    //
+    inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+
+}  // namespace hinder
@@ -28,6 +28,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <concepts>
 #include <condition_variable>
 #include <hinder/exception/exception.h>
 #include <limits>
@@ -52,6 +53,19 @@ namespace hinder {
         con.size();
     };
 
+    // Concept: Notifier is told (outside the queue lock) after every successful push(). Lets an
+    // event loop that cannot block in pop() learn that items are available, e.g. via an eventfd
+    // (see hinder/eventfd_notifier.h).
+    template <typename N>
+    concept queue_notifier = std::default_initializable<N> && requires(N notifier) {
+        notifier.notify();
+    };
+
+    // Default notifier: does nothing and occupies no space.
+    struct null_notifier {
+        auto notify() noexcept -> void {}
+    };
+
     // Generic bounded, thread-safe queue supporting multiple producers/consumers.
     //
     // Capabilities:
@@ -61,13 +75,17 @@ namespace hinder {
     // - push() blocks until space is available or times out; returns false on timeout or close
     // - pop() blocks until an item is available or times out; returns nullopt on timeout
     // - After close(): push() returns false immediately; pop() drains remaining items then nullopt
+    // - try_pop_bulk() drains up to N items without blocking
+    // - Optional Notifier is signalled after each successful push() (default: none)
     //
     // Invariants:
     // - Bound is positive and constant after construction
     // - Queue size is always >= 0 and <= bound
     //
     // Thread safety: all public operations are thread-safe.
-    template <typename T, queue_container Container = std::queue<T>>
+    template <typename T,
+              queue_container Container = std::queue<T>,
+              queue_notifier  Notifier  = null_notifier>
     class queue {
     public:
         // Use steady_clock to avoid time-travel if the system clock is adjusted.
@@ -135,6 +153,8 @@ namespace hinder {
             m_queue.push(std::forward<V>(val));
             m_size.fetch_add(1);
             m_not_empty.notify_one();
+            lck.unlock();
+            m_notifier.notify();
             return true;
         }
 
@@ -158,6 +178,45 @@ namespace hinder {
             return std::make_optional(std::move(val));
         }
 
+        // Pop up to max_items without blocking, writing them to out in FIFO order.
+        // Returns the number of items popped; 0 if the queue is empty.
+        // With a coalescing notifier (eventfd_notifier), one wakeup can stand for more than
+        // max_items items: after a wakeup, call this until it returns 0 before waiting again.
+        template <typename OutputIt>
+        auto try_pop_bulk(OutputIt out,
+                          std::size_t max_items = std::numeric_limits<std::size_t>::max())
+            -> std::size_t
+        {
+            std::size_t count = 0;
+            {
+                std::unique_lock<std::mutex> lck(m_highlander);
+                try {
+                    while (count < max_items && !m_queue.empty()) {
+                        *out = std::move(m_queue.front());
+                        ++out;
+                        m_queue.pop();
+                        ++count;
+                    }
+                } catch (...) {
+                    // Account for the items already popped before out threw.
+                    m_size.fetch_sub(count);
+                    lck.unlock();
+                    if (count > 0) {
+                        m_not_full.notify_all();
+                    }
+                    throw;
+                }
+                m_size.fetch_sub(count);
+            }
+            if (count > 0) {
+                m_not_full.notify_all();
+            }
+            return count;
+        }
+
+        // The notifier signalled by push().
+        [[nodiscard]] auto notifier() noexcept -> Notifier& { return m_notifier; }
+
     private:
         Container                m_queue {};
         const std::size_t        m_bound;
@@ -166,6 +225,7 @@ namespace hinder {
         std::mutex               m_highlander;    // there can be only one
         std::condition_variable  m_not_empty;     // the queue is no longer empty
         std::condition_variable  m_not_full;      // the queue is no longer full
+        [[no_unique_address]] Notifier m_notifier;
     };
 
 }  // namespace hinder
@@ -0,0 +1,126 @@
+#pragma once
+
+//
+// hinder::reclaim
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <hinder/reclaim/retired.h>
+
+namespace hinder {
+
+    namespace detail {
+        struct epoch_record;
+    }  // namespace detail
+
+    //
+    // Safe memory reclamation for lock-free data structures using epoch-based reclamation (EBR).
+    //
+    // A guard pins the current global epoch for its lifetime; every pointer loaded while pinned
+    // stays valid until the guard is destroyed. A node retired in epoch e is freed once the global
+    // epoch reaches e + 2, which requires every pinned guard to have observed e + 1.
+    //
+    // Compared with hazard_domain, protect() is a plain load (no store/fence per pointer), which
+    // makes traversals much cheaper. The trade-off: a thread that stalls while holding a guard
+    // stops the epoch from advancing, so memory is NOT bounded in that case. Use hazard_domain
+    // where a stalled reader must not be able to grow memory without bound.
+    //
+    // Properties:
+    // - Retire lists are per record; a record is owned by one guard (hence one thread) at a time
+    // - Reclamation is amortized: a record tries to advance the epoch and free its list only when
+    //   the list reaches reclaim_threshold
+    //
+    // Same guard interface as hazard_domain.
+    //
+    class epoch_domain {
+    public:
+        explicit epoch_domain(std::size_t reclaim_threshold = 64);
+
+        // Frees every retired node. No guard may be alive.
+        ~epoch_domain();
+
+        epoch_domain(epoch_domain const &)                     = delete;
+        auto operator=(epoch_domain const &) -> epoch_domain & = delete;
+        epoch_domain(epoch_domain &&)                          = delete;
+        auto operator=(epoch_domain &&) -> epoch_domain &      = delete;
+
+        //
+        // Scoped critical section. Not thread-safe itself: use one guard per thread, and keep it
+        // short (one operation): a live guard holds the epoch back for every thread.
+        //
+        class guard {
+        public:
+            explicit guard(epoch_domain & domain);
+            ~guard();
+
+            guard(guard const &)                     = delete;
+            auto operator=(guard const &) -> guard & = delete;
+            guard(guard &&)                          = delete;
+            auto operator=(guard &&) -> guard &      = delete;
+
+            // Load src. The result stays valid for the lifetime of the guard; slot is accepted
+            // for interface compatibility with hazard_domain and ignored.
+            template <typename T>
+            auto protect(std::atomic<T *> const & src, [[maybe_unused]] std::size_t slot = 0)
+                -> T * {
+                return src.load(std::memory_order_acquire);
+            }
+
+            // No-op; provided for interface compatibility with hazard_domain.
+            auto reset([[maybe_unused]] std::size_t slot = 0) noexcept -> void {}
+
+            // Hand an unlinked node to the domain; it is deleted two epochs later.
+            template <typename T>
+            auto retire(T * ptr) -> void {
+                retire(ptr, &detail::delete_as<T>);
+            }
+
+            auto retire(void * ptr, void (*deleter)(void *)) -> void;
+
+        private:
+            epoch_domain &         m_domain;
+            detail::epoch_record * m_record;
+        };
+
+        // Approximate number of nodes retired but not yet freed (for monitoring and tests).
+        [[nodiscard]] auto pending() const noexcept -> std::size_t;
+
+        // The current global epoch (for monitoring and tests).
+        [[nodiscard]] auto epoch() const noexcept -> std::uint64_t;
+
+    private:
+        auto acquire_record() -> detail::epoch_record *;
+        auto try_advance() -> std::uint64_t;
+        auto reclaim(detail::epoch_record & record) -> void;
+
+        std::size_t                         m_reclaim_threshold;
+        std::atomic<std::uint64_t>          m_epoch {1};  // 0 means "not pinned" in records
+        std::atomic<detail::epoch_record *> m_head {nullptr};
+        std::atomic<std::size_t>            m_pending {0};
+    };
+
+}  // namespace hinder
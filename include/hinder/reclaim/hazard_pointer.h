@@ -0,0 +1,143 @@
+#pragma once
+
+//
+// hinder::reclaim
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <cstddef>
+#include <hinder/reclaim/retired.h>
+
+namespace hinder {
+
+    namespace detail {
+        struct hazard_record;
+    }  // namespace detail
+
+    //
+    // Safe memory reclamation for lock-free data structures using hazard pointers.
+    //
+    // A reader publishes the pointer it is about to dereference in a hazard slot (protect());
+    // a writer that unlinks a node hands it to retire() instead of deleting it. Retired nodes are
+    // freed only once no hazard slot holds them.
+    //
+    // Properties:
+    // - Retire lists are per record; a record is owned by one guard (hence one thread) at a time
+    // - Scanning is amortized: a record scans all hazards only when its retire list reaches
+    //   max(scan_threshold, 2 * total hazard slots), so each scan frees at least half the list
+    // - Memory is bounded even if a reader stalls: a stalled thread pins at most slots_per_guard
+    //   nodes, and every retire list stays below the scan threshold plus the total slot count
+    //
+    // Same guard interface as epoch_domain, so a data structure can be parameterized on either.
+    //
+    // Example (Treiber stack pop):
+    //   hinder::hazard_domain::guard grd(domain);
+    //   node * top = grd.protect(head);
+    //   while (top && !head.compare_exchange_weak(top, top->next)) {
+    //       top = grd.protect(head);
+    //   }
+    //   grd.reset();
+    //   if (top) { value = top->value; grd.retire(top); }
+    //
+    class hazard_domain {
+    public:
+        // Hazard slots available to each guard (e.g., a Michael-Scott queue needs two).
+        static constexpr std::size_t slots_per_guard = 4;
+
+        explicit hazard_domain(std::size_t scan_threshold = 64);
+
+        // Frees every retired node. No guard may be alive.
+        ~hazard_domain();
+
+        hazard_domain(hazard_domain const &)                     = delete;
+        auto operator=(hazard_domain const &) -> hazard_domain & = delete;
+        hazard_domain(hazard_domain &&)                          = delete;
+        auto operator=(hazard_domain &&) -> hazard_domain &      = delete;
+
+        //
+        // Scoped access to the domain. Not thread-safe itself: use one guard per thread.
+        //
+        class guard {
+        public:
+            explicit guard(hazard_domain & domain);
+            ~guard();
+
+            guard(guard const &)                     = delete;
+            auto operator=(guard const &) -> guard & = delete;
+            guard(guard &&)                          = delete;
+            auto operator=(guard &&) -> guard &      = delete;
+
+            // Load src and publish the result in hazard slot, retrying until the published value
+            // is still current. The returned node stays valid until reset(slot) or the next
+            // protect() on the same slot.
+            // Precondition: slot < slots_per_guard
+            template <typename T>
+            auto protect(std::atomic<T *> const & src, std::size_t slot = 0) -> T * {
+                HINDER_EXPECTS(slot < slots_per_guard, reclaim_error);
+                T * ptr = src.load(std::memory_order_relaxed);
+                while (true) {
+                    publish(slot, ptr);
+                    // seq_cst, not acquire: the re-read must not be ordered before the seq_cst
+                    // store in publish(), or this thread and scan() can each miss the other.
+                    T * current = src.load(std::memory_order_seq_cst);
+                    if (current == ptr) {
+                        return ptr;
+                    }
+                    ptr = current;
+                }
+            }
+
+            // Clear hazard slot.
+            auto reset(std::size_t slot = 0) -> void;
+
+            // Hand an unlinked node to the domain; it is deleted once no hazard refers to it.
+            template <typename T>
+            auto retire(T * ptr) -> void {
+                retire(ptr, &detail::delete_as<T>);
+            }
+
+            auto retire(void * ptr, void (*deleter)(void *)) -> void;
+
+        private:
+            auto publish(std::size_t slot, void const * ptr) noexcept -> void;
+
+            hazard_domain &         m_domain;
+            detail::hazard_record * m_record;
+        };
+
+        // Approximate number of nodes retired but not yet freed (for monitoring and tests).
+        [[nodiscard]] auto pending() const noexcept -> std::size_t;
+
+    private:
+        auto acquire_record() -> detail::hazard_record *;
+        auto scan(detail::hazard_record & record) -> void;
+
+        std::size_t                          m_scan_threshold;
+        std::atomic<detail::hazard_record *> m_head {nullptr};
+        std::atomic<std::size_t>             m_records {0};
+        std::atomic<std::size_t>             m_pending {0};
+    };
+
+}  // namespace hinder
@@ -0,0 +1,58 @@
+#pragma once
+
+//
+// hinder::reclaim
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstdint>
+#include <hinder/exception/exception.h>
+
+namespace hinder {
+
+    HINDER_DEFINE_EXCEPTION(reclaim_error, generic_error);
+
+    //
+    // A node handed to a reclamation domain's retire(), awaiting the point where no reader can
+    // still hold it. Shared by hazard_domain and epoch_domain.
+    //
+    struct retired_ptr {
+        void * ptr {nullptr};
+        void (*deleter)(void *) {nullptr};
+        std::uint64_t epoch {0};  // epoch_domain only: global epoch at retirement
+
+        auto reclaim() const -> void { deleter(ptr); }
+    };
+
+    namespace detail {
+
+        // Type-erased "delete static_cast<T*>(ptr)".
+        template <typename T>
+        auto delete_as(void * ptr) -> void {
+            delete static_cast<T *>(ptr);  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+
+    }  // namespace detail
+
+}  // namespace hinder
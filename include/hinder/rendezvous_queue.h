@@ -0,0 +1,198 @@
+#pragma once
+
+//
+// hinder::queue
+//
+// MIT License
+//
+// Copyright (c) 2017-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <hinder/platform.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace hinder {
+
+    // Zero-capacity, thread-safe MPMC channel: every push() is a rendezvous with a pop().
+    //
+    // Capabilities:
+    // - Store any move-constructible type T
+    // - push() blocks until a consumer has taken the item or the timeout elapses; returns false
+    //   on timeout or close, in which case the value is left untouched
+    // - pop() blocks until a producer offers an item or the timeout elapses; returns nullopt on
+    //   timeout or close
+    // - The item is move-constructed directly from the producer's argument into the consumer's
+    //   result; it is never stored in a container
+    // - Waiting spins briefly before parking on a condition variable, so hand-offs between
+    //   threads that are already waiting avoid a futex sleep/wake round trip
+    // - After close(): push() and pop() return false/nullopt immediately; a pending offer is
+    //   withdrawn and its push() returns false
+    //
+    // Invariants:
+    // - At most one offer is published at a time
+    // - A push() that returns true has transferred its item to exactly one pop()
+    //
+    // Thread safety: all public operations are thread-safe.
+    template <typename T>
+    class rendezvous_queue {
+    public:
+        // Use steady_clock to avoid time-travel if the system clock is adjusted.
+        using clock_t    = std::chrono::steady_clock;
+        using duration_t = clock_t::duration;
+
+        // Default timeout for push() and pop(): 60 seconds.
+        static constexpr duration_t default_timeout = std::chrono::seconds(60);
+
+        // Iterations to busy-wait before parking on a condition variable.
+        static constexpr int spin_limit = 256;
+
+        rendezvous_queue()                                            = default;
+        ~rendezvous_queue()                                           = default;
+        rendezvous_queue(const rendezvous_queue&)                     = delete;
+        auto operator=(const rendezvous_queue&) -> rendezvous_queue&  = delete;
+        rendezvous_queue(rendezvous_queue&&)                          = delete;
+        auto operator=(rendezvous_queue&&) -> rendezvous_queue&       = delete;
+
+        // Returns true if close() has been called.
+        [[nodiscard]] auto closed() const noexcept -> bool { return m_closed.load(); }
+
+        // Close the channel and wake all blocked producers and consumers.
+        // Idempotent: calling close() on an already-closed channel is harmless.
+        auto close() -> void
+        {
+            {
+                std::unique_lock<std::mutex> lck(m_highlander);
+                m_closed.store(true);
+            }
+            m_offered.notify_all();
+            m_taken.notify_all();
+        }
+
+        // Offer a value and wait for a consumer to take it.
+        // Returns true once a consumer has the item; false on timeout or if the channel is closed.
+        template <typename V>
+        [[nodiscard]] auto push(V&& val, duration_t timeout = default_timeout) -> bool
+        {
+            if (m_closed.load()) {
+                return false;
+            }
+            auto const deadline = clock_t::now() + timeout;
+
+            offer_t offer;
+            offer.apply = [](void* arg, std::optional<T>& out) -> void {
+                out.emplace(std::forward<V>(*static_cast<std::remove_reference_t<V>*>(arg)));
+            };
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): restored to V in apply
+            offer.arg = const_cast<void*>(static_cast<const void*>(std::addressof(val)));
+
+            // Wait for the single offer slot, then publish.
+            {
+                std::unique_lock<std::mutex> lck(m_highlander);
+                if (!m_taken.wait_until(lck, deadline, [this]() -> bool {
+                        return m_closed.load() || m_offer.load() == nullptr;
+                    })
+                    || m_closed.load()) {
+                    return false;
+                }
+                m_offer.store(&offer);
+            }
+            m_offered.notify_one();
+
+            // Wait for a consumer to take it.
+            if (spin_until([&offer]() -> bool { return offer.taken.load(); })) {
+                return true;
+            }
+            std::unique_lock<std::mutex> lck(m_highlander);
+            m_taken.wait_until(lck, deadline, [this, &offer]() -> bool {
+                return m_closed.load() || offer.taken.load();
+            });
+            if (offer.taken.load()) {
+                return true;
+            }
+
+            // Timed out or closed: withdraw the offer and let the next producer publish.
+            m_offer.store(nullptr);
+            lck.unlock();
+            m_taken.notify_all();
+            return false;
+        }
+
+        // Wait for a producer's offer and take it.
+        // Returns the item on success; nullopt on timeout or if the channel is closed.
+        [[nodiscard]] auto pop(duration_t timeout = default_timeout) -> std::optional<T>
+        {
+            auto const deadline = clock_t::now() + timeout;
+            spin_until([this]() -> bool { return m_closed.load() || m_offer.load() != nullptr; });
+
+            std::unique_lock<std::mutex> lck(m_highlander);
+            if (!m_offered.wait_until(lck, deadline, [this]() -> bool {
+                    return m_closed.load() || m_offer.load() != nullptr;
+                })
+                || m_closed.load()) {
+                return std::nullopt;
+            }
+
+            std::optional<T> result;
+            auto*            offer = m_offer.load();
+            offer->apply(offer->arg, result);
+            m_offer.store(nullptr);
+            // The producer may return (destroying offer) as soon as it sees this store.
+            offer->taken.store(true);
+            lck.unlock();
+            m_taken.notify_all();
+            return result;
+        }
+
+    private:
+        // Lives on the producer's stack for the duration of push().
+        struct offer_t {
+            void (*apply)(void*, std::optional<T>&) {nullptr};
+            void*             arg {nullptr};
+            std::atomic<bool> taken {false};
+        };
+
+        template <typename Pred>
+        static auto spin_until(Pred pred) -> bool
+        {
+            for (int spin = 0; spin < spin_limit; ++spin) {
+                if (pred()) {
+                    return true;
+                }
+                cpu_relax();
+            }
+            return pred();
+        }
+
+        std::atomic<offer_t*>   m_offer {nullptr};  // the published offer, if any
+        std::atomic<bool>       m_closed {false};
+        std::mutex              m_highlander;       // there can be only one
+        std::condition_variable m_offered;          // an offer was published
+        std::condition_variable m_taken;            // an offer was taken or withdrawn
+    };
+
+}  // namespace hinder
@@ -0,0 +1,119 @@
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/assert/handlers/abort.h>
+#include <hinder/assert/handlers/callback.h>
+#include <hinder/assert/handlers/continue.h>
+#include <hinder/assert/violation.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+
+namespace hinder {
+
+    namespace {
+
+        // Longest line log_violation() writes; longer lines are truncated.
+        constexpr std::size_t max_line = 1024;
+
+        auto callback_slot() noexcept -> std::atomic<contract_callback> & {
+            static std::atomic<contract_callback> callback {nullptr};
+            return callback;
+        }
+
+        auto text_or(char const * text, char const * fallback) noexcept -> char const * {
+            return text != nullptr ? text : fallback;
+        }
+
+        // %.*s takes an int precision.
+        auto precision(std::string_view text) noexcept -> int {
+            return static_cast<int>(std::min<std::size_t>(text.size(), max_line));
+        }
+
+    }  // namespace
+
+    auto log_violation(contract_violation const & violation) noexcept -> void {
+        // Built in one buffer and written with one call, so lines from concurrent violations do
+        // not interleave.
+        std::array<char, max_line> line {};
+        std::size_t                used = 0;
+        auto const                 append_result = [&](int written) noexcept {
+            if (written > 0) {
+                used = std::min(used + static_cast<std::size_t>(written), line.size() - 1);
+            }
+        };
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg): snprintf does not allocate
+        append_result(std::snprintf(line.data(), line.size(), "hinder: %s failed: %s [%.*s]",
+                                    text_or(violation.site.check_type, "contract"),
+                                    text_or(violation.site.condition, "?"),
+                                    precision(violation.exception_type),
+                                    violation.exception_type.data()));
+        if (!violation.message.empty()) {
+            append_result(std::snprintf(line.data() + used, line.size() - used, ": %.*s",
+                                        precision(violation.message),
+                                        violation.message.data()));
+        }
+        if constexpr (source_info::enabled) {
+            append_result(std::snprintf(line.data() + used, line.size() - used, " at %s:%u in %s",
+                                        violation.location.file_name(),
+                                        static_cast<unsigned>(violation.location.line()),
+                                        violation.location.function_name()));
+        }
+        // NOLINTEND(cppcoreguidelines-pro-type-vararg)
+        line[used] = '\n';
+        std::fwrite(line.data(), 1, used + 1, stderr);
+        std::fflush(stderr);
+    }
+
+    auto abort_assert_handler::handle(contract_violation const & violation) noexcept -> void {
+        log_violation(violation);
+        std::abort();
+    }
+
+    auto continue_assert_handler::handle(contract_violation const & violation) noexcept -> void {
+        log_violation(violation);
+    }
+
+    auto set_contract_callback(contract_callback callback) noexcept -> contract_callback {
+        return callback_slot().exchange(callback);
+    }
+
+    auto get_contract_callback() noexcept -> contract_callback { return callback_slot().load(); }
+
+    auto callback_assert_handler::handle(contract_violation const & violation) -> void {
+        if (auto * callback = get_contract_callback(); callback != nullptr) {
+            callback(violation);
+            return;
+        }
+        abort_assert_handler::handle(violation);
+    }
+
+}  // namespace hinder
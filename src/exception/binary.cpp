@@ -0,0 +1,412 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/binary.h>
+
+#include <hinder/exception/exception.h>
+#include <hinder/exception/exception_value.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace hinder {
+
+    namespace {
+
+        constexpr std::uint8_t format_version = 1;
+        constexpr std::uint8_t flag_source    = 0x01;
+
+        // Value tags.
+        enum class tag : std::uint8_t {
+            flag,
+            false_value,
+            true_value,
+            signed_int,
+            unsigned_int,
+            floating,
+            string,
+        };
+
+        // Longest LEB128 encoding of a 64-bit value.
+        constexpr std::size_t max_varint = 10;
+
+        auto write_varint(format_sink & sink, std::uint64_t value) -> void {
+            std::array<char, max_varint> bytes {};
+            std::size_t                  size = 0;
+            while (value >= 0x80) {
+                bytes[size++] = static_cast<char>((value & 0x7F) | 0x80);
+                value >>= 7;
+            }
+            bytes[size++] = static_cast<char>(value);
+            sink.write({bytes.data(), size});
+        }
+
+        auto write_bytes(format_sink & sink, std::string_view text) -> void {
+            write_varint(sink, text.size());
+            sink.write(text);
+        }
+
+        auto write_tag(format_sink & sink, tag value) -> void {
+            sink.put(static_cast<char>(value));
+        }
+
+        auto write_key(format_sink & sink, std::string_view key, key_dictionary const * dict)
+            -> void {
+            if (dict != nullptr) {
+                if (auto const index = dict->find(key)) {
+                    write_varint(sink, (std::uint64_t {*index} << 1) | 1);
+                    return;
+                }
+            }
+            write_varint(sink, std::uint64_t {key.size()} << 1);
+            sink.write(key);
+        }
+
+        auto write_binary_value(format_sink & sink, exception_value const & value) -> void {
+            std::visit(
+                [&sink](auto const & val) -> void {
+                    using T = std::decay_t<decltype(val)>;
+                    if constexpr (std::is_same_v<T, std::monostate>) {
+                        write_tag(sink, tag::flag);
+                    } else if constexpr (std::is_same_v<T, bool>) {
+                        write_tag(sink, val ? tag::true_value : tag::false_value);
+                    } else if constexpr (std::is_same_v<T, std::int64_t>) {
+                        // Zigzag, so small negative numbers stay short.
+                        auto const bits = static_cast<std::uint64_t>(val);
+                        write_tag(sink, tag::signed_int);
+                        write_varint(sink, (bits << 1) ^ (val < 0 ? ~std::uint64_t {0} : 0));
+                    } else if constexpr (std::is_same_v<T, std::uint64_t>) {
+                        write_tag(sink, tag::unsigned_int);
+                        write_varint(sink, val);
+                    } else if constexpr (std::is_same_v<T, double>) {
+                        auto const          bits = std::bit_cast<std::uint64_t>(val);
+                        std::array<char, 8> bytes {};
+                        for (std::size_t idx = 0; idx < bytes.size(); ++idx) {
+                            bytes[idx] = static_cast<char>((bits >> (8 * idx)) & 0xFF);
+                        }
+                        write_tag(sink, tag::floating);
+                        sink.write({bytes.data(), bytes.size()});
+                    } else {
+                        write_tag(sink, tag::string);
+                        write_bytes(sink, val);
+                    }
+                },
+                value);
+        }
+
+        // Single forward pass over one record. Each read step returns nullopt or false on
+        // failure, after recording the first error.
+        class record_reader {
+        public:
+            record_reader(std::string_view bytes, key_dictionary const * dict)
+            : m_bytes(bytes),
+              m_dict(dict) {}
+
+            auto parse() -> std::expected<error_record, record_parse_error> {
+                error_record record;
+
+                auto const version = read_byte();
+                if (!version) {
+                    return std::unexpected(m_error);
+                }
+                if (*version != format_version) {
+                    m_pos = 0;
+                    fail("unsupported version");
+                    return std::unexpected(m_error);
+                }
+                auto const flags = read_byte();
+                auto const type  = flags ? read_bytes() : std::nullopt;
+                if (!type) {
+                    return std::unexpected(m_error);
+                }
+                record.type_name = *type;
+
+                if ((*flags & flag_source) != 0) {
+                    auto const file = read_bytes();
+                    if (!file) {
+                        return std::unexpected(m_error);
+                    }
+                    auto const start = m_pos;
+                    auto const line  = read_varint();
+                    if (!line) {
+                        return std::unexpected(m_error);
+                    }
+                    if (*line > std::numeric_limits<std::uint_least32_t>::max()) {
+                        m_pos = start;
+                        fail("invalid line number");
+                        return std::unexpected(m_error);
+                    }
+                    record.file = *file;
+                    record.line = static_cast<std::uint_least32_t>(*line);
+                }
+
+                auto const count = read_varint();
+                if (!count) {
+                    return std::unexpected(m_error);
+                }
+                for (std::uint64_t entry = 0; entry < *count; ++entry) {
+                    if (!read_entry(record.data)) {
+                        return std::unexpected(m_error);
+                    }
+                }
+
+                if (m_pos != m_bytes.size()) {
+                    fail("unexpected bytes after the record");
+                    return std::unexpected(m_error);
+                }
+                return record;
+            }
+
+        private:
+            auto fail(char const * reason) -> void { m_error = {reason, m_pos}; }
+
+            auto read_byte() -> std::optional<std::uint8_t> {
+                if (m_pos == m_bytes.size()) {
+                    fail("truncated record");
+                    return std::nullopt;
+                }
+                return static_cast<std::uint8_t>(m_bytes[m_pos++]);
+            }
+
+            auto read_varint() -> std::optional<std::uint64_t> {
+                auto const    start = m_pos;
+                std::uint64_t value = 0;
+                for (std::size_t idx = 0; idx < max_varint; ++idx) {
+                    auto const byte = read_byte();
+                    if (!byte) {
+                        return std::nullopt;
+                    }
+                    // The tenth byte holds only the top bit of a 64-bit value.
+                    if (idx == max_varint - 1 && *byte > 1) {
+                        break;
+                    }
+                    value |= std::uint64_t {*byte & 0x7FU} << (7 * idx);
+                    if ((*byte & 0x80) == 0) {
+                        return value;
+                    }
+                }
+                m_pos = start;
+                fail("varint too long");
+                return std::nullopt;
+            }
+
+            // size bytes, in place.
+            auto read_span(std::uint64_t size) -> std::optional<std::string_view> {
+                if (size > m_bytes.size() - m_pos) {
+                    fail("truncated record");
+                    return std::nullopt;
+                }
+                auto const text = m_bytes.substr(m_pos, size);
+                m_pos += size;
+                return text;
+            }
+
+            // A length-prefixed string, in place.
+            auto read_bytes() -> std::optional<std::string_view> {
+                auto const size = read_varint();
+                return size ? read_span(*size) : std::nullopt;
+            }
+
+            auto read_key() -> std::optional<std::string_view> {
+                auto const start = m_pos;
+                auto const key   = read_varint();
+                if (!key) {
+                    return std::nullopt;
+                }
+                if ((*key & 1) == 0) {
+                    return read_span(*key >> 1);
+                }
+                auto const name = m_dict == nullptr ? std::nullopt : m_dict->key(*key >> 1);
+                if (!name) {
+                    m_pos = start;
+                    fail("key not in dictionary");
+                }
+                return name;
+            }
+
+            auto read_entry(exception_data & data) -> bool {
+                auto const key = read_key();
+                if (!key) {
+                    return false;
+                }
+                auto const start = m_pos;
+                auto const type  = read_byte();
+                if (!type) {
+                    return false;
+                }
+                switch (static_cast<tag>(*type)) {
+                case tag::flag:
+                    data.set(exception_key(*key), std::monostate {});
+                    return true;
+                case tag::false_value:
+                    data.set(exception_key(*key), false);
+                    return true;
+                case tag::true_value:
+                    data.set(exception_key(*key), true);
+                    return true;
+                case tag::signed_int: {
+                    auto const bits = read_varint();
+                    if (!bits) {
+                        return false;
+                    }
+                    auto const value = static_cast<std::int64_t>((*bits >> 1) ^ (~(*bits & 1) + 1));
+                    data.set(exception_key(*key), value);
+                    return true;
+                }
+                case tag::unsigned_int: {
+                    auto const value = read_varint();
+                    if (!value) {
+                        return false;
+                    }
+                    data.set(exception_key(*key), *value);
+                    return true;
+                }
+                case tag::floating: {
+                    auto const bytes = read_span(8);
+                    if (!bytes) {
+                        return false;
+                    }
+                    std::uint64_t bits = 0;
+                    for (std::size_t idx = 0; idx < bytes->size(); ++idx) {
+                        bits |= std::uint64_t {static_cast<std::uint8_t>((*bytes)[idx])}
+                                << (8 * idx);
+                    }
+                    data.set(exception_key(*key), std::bit_cast<double>(bits));
+                    return true;
+                }
+                case tag::string: {
+                    auto const text = read_bytes();
+                    if (!text) {
+                        return false;
+                    }
+                    data.set(exception_key(*key), std::string(*text));
+                    return true;
+                }
+                }
+                m_pos = start;
+                fail("invalid value tag");
+                return false;
+            }
+
+            std::string_view       m_bytes;
+            key_dictionary const * m_dict;
+            std::size_t            m_pos {0};
+            record_parse_error     m_error {"", 0};
+        };
+
+    }  // namespace
+
+    key_dictionary::key_dictionary(std::initializer_list<std::string_view> keys)
+    : key_dictionary(std::span<std::string_view const>(keys.begin(), keys.size())) {}
+
+    key_dictionary::key_dictionary(std::span<std::string_view const> keys)
+    : m_keys(keys.begin(), keys.end()) {
+        m_index.reserve(m_keys.size());
+        for (std::size_t idx = 0; idx < m_keys.size(); ++idx) {
+            // The first occurrence of a repeated key wins, on both sides.
+            m_index.emplace(m_keys[idx], static_cast<std::uint32_t>(idx));
+        }
+    }
+
+    auto key_dictionary::find(std::string_view key) const -> std::optional<std::uint32_t> {
+        auto const iter = m_index.find(key);
+        if (iter == m_index.end()) {
+            return std::nullopt;
+        }
+        return iter->second;
+    }
+
+    auto key_dictionary::key(std::uint64_t index) const -> std::optional<std::string_view> {
+        if (index >= m_keys.size()) {
+            return std::nullopt;
+        }
+        return m_keys[index];
+    }
+
+    auto detail::write_binary_record(format_sink &          sink,
+                                     std::string_view       type_name,
+                                     source_info const &    loc,
+                                     exception_data const & data,
+                                     key_dictionary const * dict) -> void {
+        // Header
+        sink.put(static_cast<char>(format_version));
+        sink.put(static_cast<char>(source_info::enabled ? flag_source : 0));
+        write_bytes(sink, type_name);
+
+        // Source location
+        if constexpr (source_info::enabled) {
+            write_bytes(sink, loc.file_name());
+            write_varint(sink, loc.line());
+        }
+
+        // Data
+        write_varint(sink, data.size());
+        for (auto const & [key, value] : data) {
+            write_key(sink, key.view(), dict);
+            write_binary_value(sink, value);
+        }
+    }
+
+    auto detail::write_binary(format_sink &          sink,
+                              exception const &      exc,
+                              key_dictionary const * dict) -> void {
+        write_binary_record(sink, exc.type_name(), exc.location(), exc.data(), dict);
+    }
+
+    auto to_binary(exception const & exc, key_dictionary const * dict) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        detail::write_binary(sink, exc, dict);
+        sink.flush();
+        return result;
+    }
+
+    auto to_binary_to(std::span<char> buffer, exception const & exc, key_dictionary const * dict)
+        -> std::size_t {
+        format_sink sink(buffer);
+        detail::write_binary(sink, exc, dict);
+        sink.flush();
+        return sink.written();
+    }
+
+    auto parse_binary_record(std::string_view bytes, key_dictionary const * dict)
+        -> std::expected<error_record, record_parse_error> {
+        return record_reader(bytes, dict).parse();
+    }
+
+}  // namespace hinder
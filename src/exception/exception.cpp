@@ -28,8 +28,10 @@
 #include <hinder/exception/exception_value.h>
 
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <source_location>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -38,20 +40,51 @@
 
 namespace hinder {
 
+#if defined(HINDER_WITH_STACK_TRACE)
+    exception::exception(std::source_location loc)
+    : std::runtime_error("exception"),
+      m_location(loc),
+      m_trace(stack_trace::capture()) {}
+
+    auto exception::trace() const noexcept -> stack_trace const * { return &m_trace; }
+#else
     exception::exception(std::source_location loc)
     : std::runtime_error("exception"),
       m_location(loc) {}
 
-    auto exception::with(std::string_view key) -> exception & {
-        m_data[std::string(key)] = std::monostate {};
+    auto exception::trace() const noexcept -> stack_trace const * { return nullptr; }
+#endif
+
+    auto exception::with(exception_key key) -> exception & {
+        m_data.set(std::move(key), std::monostate {});
         return *this;
     }
 
-    void exception::with_impl(std::string_view key, exception_value val) {
-        m_data[std::string(key)] = std::move(val);
+    auto exception::with_site(throw_site const & site) -> exception & {
+        m_site = &site;
+        m_data.set(site);
+        return *this;
     }
 
-    void exception::message_impl(std::string msg) { m_data["message"] = std::move(msg); }
+    void exception::with_impl(exception_key key, exception_value val) {
+        m_data.set(std::move(key), std::move(val));
+    }
+
+    void exception::message_impl(std::string msg) { m_data.set("message", std::move(msg)); }
+
+    void exception::message_impl(std::unique_ptr<detail::deferred_value> msg) {
+        m_data.set("message", std::move(msg));
+    }
+
+    void exception::site_impl(throw_site const & site) {
+        m_site = &site;
+        m_data.set(site);
+    }
+
+    void exception::adopt_impl(source_info loc, data_map data) {
+        m_location = loc;
+        m_data     = std::move(data);
+    }
 
     auto exception::get(std::string_view key) const -> std::optional<exception_value> {
         auto iter = m_data.find(key);
@@ -61,8 +94,13 @@ namespace hinder {
         return iter->second;
     }
 
+    auto exception::get_ref(std::string_view key) const -> exception_value const * {
+        auto iter = m_data.find(key);
+        return iter == m_data.end() ? nullptr : &iter->second;
+    }
+
     auto exception::contains(std::string_view key) const -> bool {
-        return m_data.find(key) != m_data.end();
+        return m_data.contains(key);
     }
 
     auto exception::begin() const -> const_iterator { return m_data.begin(); }
@@ -71,12 +109,22 @@ namespace hinder {
 
     auto exception::size() const -> std::size_t { return m_data.size(); }
 
+    auto exception::data() const noexcept -> data_map const & { return m_data; }
+
+    auto exception::frames() const noexcept -> std::span<context_frame const> {
+        return m_data.frames();
+    }
+
+    auto exception::dropped_frames() const noexcept -> std::size_t {
+        return m_data.dropped_frames();
+    }
+
     auto exception::type_name() const -> std::string_view { return m_type_name; }
 
-    auto exception::location() const -> std::source_location const & { return m_location; }
+    auto exception::location() const -> source_info const & { return m_location; }
 
-    auto exception::what() const noexcept -> char const * { return m_type_name.c_str(); }
+    auto exception::what() const noexcept -> char const * { return m_type_name; }
 
-    void exception::set_type_name(std::string_view name) { m_type_name = name; }
+    void exception::set_type_name(char const * name) { m_type_name = name; }
 
 }  // namespace hinder
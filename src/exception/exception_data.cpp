@@ -0,0 +1,317 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/exception_data.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace hinder {
+
+    namespace detail {
+
+        // Element moves during insertion and growth are assumed not to throw.
+        static_assert(std::is_nothrow_move_constructible_v<exception_storage::value_type>);
+        static_assert(std::is_nothrow_swappable_v<exception_storage::value_type>);
+
+        // Frames are copied as plain bytes.
+        static_assert(std::is_trivially_copyable_v<context_frame>);
+
+        exception_storage::~exception_storage() { free_entries(); }
+
+        exception_storage::exception_storage(exception_storage const & other) {
+            // Lock only if a render through another handle could be in progress.
+            std::unique_lock<std::mutex> lck(other.m_render, std::defer_lock);
+            if (other.m_pending.load(std::memory_order_acquire)) {
+                lck.lock();
+            }
+            reserve(other.m_size);
+            // The destructor does not run if this constructor throws, so release the entries and
+            // any heap array here.
+            try {
+                std::uninitialized_copy(other.m_begin, other.m_begin + other.m_size, m_begin);
+                m_size = other.m_size;
+                if (other.m_frames) {
+                    m_frames = std::make_unique_for_overwrite<context_frame[]>(frame_capacity);
+                    std::copy_n(other.m_frames.get(), other.m_frame_count, m_frames.get());
+                }
+                m_frame_count    = other.m_frame_count;
+                m_frames_dropped = other.m_frames_dropped;
+                if (other.m_pending.load(std::memory_order_relaxed)) {
+                    if (other.m_deferred) {
+                        m_deferred_key = other.m_deferred_key;
+                        m_deferred     = other.m_deferred->clone();
+                    }
+                    m_site = other.m_site;
+                    m_pending.store(true, std::memory_order_relaxed);
+                }
+            } catch (...) {
+                free_entries();
+                throw;
+            }
+        }
+
+        auto exception_storage::free_entries() noexcept -> void {
+            std::destroy(m_begin, m_begin + m_size);
+            if (!is_inline()) {
+                ::operator delete(m_begin, std::align_val_t {alignof(value_type)});
+            }
+        }
+
+        auto exception_storage::set(exception_key key, exception_value value) -> void {
+            if (m_site != nullptr) {
+                // Materialize now so a later render cannot overwrite an eager value under a site
+                // key.
+                render_site();
+                m_pending.store(m_deferred != nullptr, std::memory_order_relaxed);
+            }
+            if (m_deferred && m_deferred_key == key.view()) {
+                // An eager value replaces the deferred one.
+                m_deferred.reset();
+                m_pending.store(false, std::memory_order_relaxed);
+            }
+            auto const pos = lower_bound(key.view());
+            if (pos < m_size && m_begin[pos].first == key.view()) {
+                m_begin[pos].second = std::move(value);
+                return;
+            }
+            if (m_size == m_capacity) {
+                reserve(2 * m_capacity);
+            }
+            std::construct_at(m_begin + m_size, std::move(key), std::move(value));
+            ++m_size;
+            std::rotate(m_begin + pos, m_begin + m_size - 1, m_begin + m_size);
+        }
+
+        auto exception_storage::set(exception_key key, std::unique_ptr<deferred_value> value)
+            -> void {
+            if (m_deferred && m_deferred_key != key.view()) {
+                render();
+            }
+            set(key, std::monostate {});  // placeholder until rendered
+            m_deferred_key = std::move(key);
+            m_deferred     = std::move(value);
+            m_pending.store(true, std::memory_order_relaxed);
+        }
+
+        auto exception_storage::set(throw_site const & site) -> void {
+            if (site.condition != nullptr) {
+                set("condition", std::monostate {});  // placeholders until rendered
+            }
+            if (site.check_type != nullptr) {
+                set("check_type", std::monostate {});
+            }
+            m_site = &site;
+            m_pending.store(true, std::memory_order_relaxed);
+        }
+
+        auto exception_storage::add_frame(context_frame const & frame) -> void {
+            if (m_frame_count == frame_capacity) {
+                ++m_frames_dropped;
+                return;
+            }
+            if (!m_frames) {
+                m_frames = std::make_unique_for_overwrite<context_frame[]>(frame_capacity);
+            }
+            m_frames[m_frame_count++] = frame;
+        }
+
+        auto exception_storage::find(std::string_view key) const -> value_type const * {
+            render();
+            auto const pos = lower_bound(key);
+            if (pos < m_size && m_begin[pos].first == key) {
+                return m_begin + pos;
+            }
+            return m_begin + m_size;
+        }
+
+        auto exception_storage::contains(std::string_view key) const -> bool {
+            auto const pos = lower_bound(key);
+            return pos < m_size && m_begin[pos].first == key;
+        }
+
+        auto exception_storage::lower_bound(std::string_view key) const -> std::size_t {
+            auto const by_key = [](value_type const & entry, std::string_view target) -> bool {
+                return entry.first.view() < target;
+            };
+            auto const * iter = std::lower_bound(m_begin, m_begin + m_size, key, by_key);
+            return static_cast<std::size_t>(iter - m_begin);
+        }
+
+        auto exception_storage::render() const -> void {
+            if (!m_pending.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lck(m_render);
+            if (!m_pending.load(std::memory_order_relaxed)) {
+                return;  // another reader rendered it first
+            }
+            render_site();
+            if (m_deferred) {
+                auto const pos      = lower_bound(m_deferred_key.view());
+                m_begin[pos].second = m_deferred->render();
+                m_deferred.reset();
+            }
+            m_pending.store(false, std::memory_order_release);
+        }
+
+        auto exception_storage::render_site() const -> void {
+            if (m_site == nullptr) {
+                return;
+            }
+            if (m_site->condition != nullptr) {
+                m_begin[lower_bound("condition")].second = std::string(m_site->condition);
+            }
+            if (m_site->check_type != nullptr) {
+                m_begin[lower_bound("check_type")].second = std::string(m_site->check_type);
+            }
+            m_site = nullptr;
+        }
+
+        auto exception_storage::is_inline() const noexcept -> bool {
+            return static_cast<void const *>(m_begin) == static_cast<void const *>(m_inline);
+        }
+
+        auto exception_storage::inline_storage() noexcept -> value_type * {
+            return reinterpret_cast<value_type *>(m_inline);  // NOLINT(*-reinterpret-cast)
+        }
+
+        auto exception_storage::frame_storage() const noexcept -> context_frame const * {
+            return m_frames.get();
+        }
+
+        auto exception_storage::reserve(std::size_t capacity) -> void {
+            if (capacity <= m_capacity) {
+                return;
+            }
+            auto * fresh = static_cast<value_type *>(::operator new(
+                capacity * sizeof(value_type), std::align_val_t {alignof(value_type)}));
+            std::uninitialized_move(m_begin, m_begin + m_size, fresh);
+            std::destroy(m_begin, m_begin + m_size);
+            if (!is_inline()) {
+                ::operator delete(m_begin, std::align_val_t {alignof(value_type)});
+            }
+            m_begin    = fresh;
+            m_capacity = capacity;
+        }
+
+    }  // namespace detail
+
+    exception_data::~exception_data() { release(); }
+
+    exception_data::exception_data(exception_data const & other) noexcept
+    : m_storage(other.m_storage) {
+        if (m_storage != nullptr) {
+            m_storage->m_refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    auto exception_data::operator=(exception_data const & other) noexcept -> exception_data & {
+        if (m_storage != other.m_storage) {
+            exception_data copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    exception_data::exception_data(exception_data && other) noexcept
+    : m_storage(std::exchange(other.m_storage, nullptr)) {}
+
+    auto exception_data::operator=(exception_data && other) noexcept -> exception_data & {
+        if (this != &other) {
+            release();
+            m_storage = std::exchange(other.m_storage, nullptr);
+        }
+        return *this;
+    }
+
+    auto exception_data::set(exception_key key, exception_value value) -> void {
+        writable().set(std::move(key), std::move(value));
+    }
+
+    auto exception_data::set(exception_key key, std::unique_ptr<detail::deferred_value> value)
+        -> void {
+        writable().set(std::move(key), std::move(value));
+    }
+
+    auto exception_data::set(throw_site const & site) -> void { writable().set(site); }
+
+    auto exception_data::add_frame(context_frame const & frame) -> void {
+        writable().add_frame(frame);
+    }
+
+    auto exception_data::frames() const noexcept -> std::span<context_frame const> {
+        if (m_storage == nullptr) {
+            return {};
+        }
+        return {m_storage->frame_storage(), m_storage->m_frame_count};
+    }
+
+    auto exception_data::find(std::string_view key) const -> const_iterator {
+        return m_storage == nullptr ? nullptr : m_storage->find(key);
+    }
+
+    auto exception_data::contains(std::string_view key) const -> bool {
+        return m_storage != nullptr && m_storage->contains(key);
+    }
+
+    auto exception_data::begin() const -> const_iterator {
+        if (m_storage == nullptr) {
+            return nullptr;
+        }
+        m_storage->render();
+        return m_storage->m_begin;
+    }
+
+    auto exception_data::writable() -> detail::exception_storage & {
+        if (m_storage == nullptr) {
+            m_storage = new detail::exception_storage();  // NOLINT(cppcoreguidelines-owning-memory)
+        } else if (m_storage->m_refs.load(std::memory_order_acquire) != 1) {
+            auto * copy = new detail::exception_storage(*m_storage);  // NOLINT(*-owning-memory)
+            release();
+            m_storage = copy;
+        }
+        return *m_storage;
+    }
+
+    auto exception_data::release() noexcept -> void {
+        auto * storage = std::exchange(m_storage, nullptr);
+        if (storage != nullptr && storage->m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete storage;  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+    }
+
+}  // namespace hinder
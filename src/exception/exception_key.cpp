@@ -0,0 +1,79 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/exception_key.h>
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+
+namespace hinder {
+
+    exception_key::~exception_key() {
+        if (!is_inline()) {
+            delete[] m_heap;  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+    }
+
+    exception_key::exception_key(exception_key const & other) { assign(other.view()); }
+
+    auto exception_key::operator=(exception_key const & other) -> exception_key & {
+        if (this != &other) {
+            exception_key copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    exception_key::exception_key(exception_key && other) noexcept { take(other); }
+
+    auto exception_key::operator=(exception_key && other) noexcept -> exception_key & {
+        if (this != &other) {
+            if (!is_inline()) {
+                delete[] m_heap;  // NOLINT(cppcoreguidelines-owning-memory)
+            }
+            take(other);
+        }
+        return *this;
+    }
+
+    auto exception_key::take(exception_key & other) noexcept -> void {
+        if (other.is_inline()) {
+            assign(other.view());  // fits inline, so cannot allocate
+        } else {
+            m_heap = other.m_heap;
+            m_size = std::exchange(other.m_size, 0);
+        }
+    }
+
+    auto exception_key::assign_heap(std::string_view key) -> void {
+        auto * buffer = new char[key.size()];  // NOLINT(cppcoreguidelines-owning-memory)
+        std::ranges::copy(key, buffer);
+        m_heap = buffer;
+        m_size = key.size();
+    }
+
+}  // namespace hinder
@@ -26,13 +26,17 @@
 
 #include <hinder/exception/exception.h>
 #include <hinder/exception/exception_value.h>
+#include <hinder/exception/format_sink.h>
 
+#include <chrono>
+#include <cstddef>
 #include <format>
-#include <iterator>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 namespace hinder {
 
@@ -54,119 +58,280 @@ namespace hinder {
             val);
     }
 
-    namespace {
+    // ========================================================================
+    // Shared formatting pieces
+    // ========================================================================
+
+    namespace detail {
 
-        auto escape_json_string(std::string_view input) -> std::string {
-            std::string result;
-            result.reserve(input.size());
-            for (char chr : input) {
-                switch (chr) {
-                case '"':
-                    result += "\\\"";
-                    break;
-                case '\\':
-                    result += "\\\\";
-                    break;
-                case '\n':
-                    result += "\\n";
-                    break;
-                case '\r':
-                    result += "\\r";
-                    break;
-                case '\t':
-                    result += "\\t";
-                    break;
-                default:
-                    if (static_cast<unsigned char>(chr) < ' ') {
-                        std::format_to(std::back_inserter(result),
-                                       "\\u{:04x}",
-                                       static_cast<unsigned>(chr));
-                    } else {
-                        result += chr;
-                    }
+        auto write_context_string(format_sink &                  sink,
+                                  std::span<context_frame const> frames,
+                                  std::size_t                    dropped) -> void {
+            if (frames.empty()) {
+                return;
+            }
+            sink.write("\n  context:");
+            for (std::size_t idx = 0; idx < frames.size(); ++idx) {
+                auto const & frame = frames[idx];
+                sink.write("\n    #");
+                sink.write_number(idx);
+                if constexpr (source_info::enabled) {
+                    sink.put(' ');
+                    sink.write(frame.location.file_name());
+                    sink.put(':');
+                    sink.write_number(frame.location.line());
                 }
+                if (frame.note != nullptr) {
+                    sink.put(' ');
+                    sink.write(frame.note);
+                }
+            }
+            if (dropped > 0) {
+                sink.write("\n    ... ");
+                sink.write_number(dropped);
+                sink.write(" more");
             }
-            return result;
         }
 
-        auto value_to_json(exception_value const & val) -> std::string {
-            return std::visit(
-                [](auto const & val) -> std::string {
-                    using T = std::remove_cvref_t<decltype(val)>;
-
-                    if constexpr (std::is_same_v<T, std::monostate>) {
-                        return "null";
-                    } else if constexpr (std::is_same_v<T, bool>) {
-                        return val ? "true" : "false";
-                    } else if constexpr (std::is_same_v<T, std::string>) {
-                        return std::format("\"{}\"", escape_json_string(val));
-                    } else {
-                        // Numeric types
-                        return std::format("{}", val);
-                    }
-                },
-                val);
+        auto write_context_json(format_sink &                  sink,
+                                std::span<context_frame const> frames,
+                                std::size_t                    dropped) -> void {
+            if (frames.empty()) {
+                return;
+            }
+            sink.write(R"(,"context":[)");
+            bool first = true;
+            for (auto const & frame : frames) {
+                sink.write(first ? "{" : ",{");
+                first = false;
+                char const * sep = "";
+                if constexpr (source_info::enabled) {
+                    sink.write(R"("file":)");
+                    write_json_string(sink, frame.location.file_name());
+                    sink.write(R"(,"line":)");
+                    sink.write_number(frame.location.line());
+                    sep = ",";
+                }
+                if (frame.note != nullptr) {
+                    sink.write(sep);
+                    sink.write(R"("note":)");
+                    write_json_string(sink, frame.note);
+                }
+                sink.put('}');
+            }
+            sink.put(']');
+            if (dropped > 0) {
+                sink.write(R"(,"context_dropped":)");
+                sink.write_number(dropped);
+            }
+        }
+
+    }  // namespace detail
+
+    namespace {
+
+        // Resolved frames of the exception's stack trace; empty if it has none.
+        auto trace_frames(exception const & exc) -> std::vector<stack_trace::frame> {
+            auto const * trace = exc.trace();
+            return trace == nullptr ? std::vector<stack_trace::frame> {} : trace->symbolize();
         }
 
     }  // namespace
 
-    auto to_string(exception const & exc) -> std::string {
-        std::string result;
+    // ========================================================================
+    // exception
+    // ========================================================================
 
+    auto detail::write_string(format_sink & sink, exception const & exc) -> void {
         // Header: type @file:line
-        auto const & loc = exc.location();
-        std::format_to(std::back_inserter(result),
-                       "{} @{}:{}",
-                       exc.type_name(),
-                       loc.file_name(),
-                       loc.line());
-
-        // Key-value pairs, indented
+        sink.write(exc.type_name());
+        if constexpr (source_info::enabled) {
+            auto const & loc = exc.location();
+            sink.write(" @");
+            sink.write(loc.file_name());
+            sink.put(':');
+            sink.write_number(loc.line());
+        }
+
+        // Key-value pairs, indented; flag-style keys have no value
         for (auto const & [key, value] : exc) {
-            auto val_str = value_to_string(value);
-            if (val_str.empty()) {
-                // Flag-style key with no value
-                std::format_to(std::back_inserter(result), "\n  {}", key);
-            } else {
-                std::format_to(std::back_inserter(result), "\n  {}: {}", key, val_str);
+            sink.write("\n  ");
+            sink.write(key.view());
+            if (!is_bare_key(value)) {
+                sink.write(": ");
+                write_value(sink, value);
             }
         }
 
-        return result;
-    }
+        // Propagation path carried over from a hinder::error
+        write_context_string(sink, exc.frames(), exc.dropped_frames());
 
-    auto to_json(exception const & exc) -> std::string {
-        std::string result;
-        result += '{';
+        // Stack trace, symbolized now rather than at the throw site
+        auto const frames = trace_frames(exc);
+        if (!frames.empty()) {
+            sink.write("\n  stack:");
+            for (std::size_t idx = 0; idx < frames.size(); ++idx) {
+                auto const & frame = frames[idx];
+                sink.write("\n    #");
+                sink.write_number(idx);
+                sink.put(' ');
+                sink.write_pointer(frame.address);
+                sink.put(' ');
+                sink.write(frame.symbol.empty() ? "??" : frame.symbol);
+                if (!frame.object.empty()) {
+                    sink.write(" (");
+                    sink.write(frame.object);
+                    sink.put(')');
+                }
+            }
+        }
+    }
 
+    auto detail::write_json(format_sink & sink, exception const & exc) -> void {
         // Type
-        std::format_to(std::back_inserter(result), R"("type":"{}")", exc.type_name());
+        sink.write(R"({"type":")");
+        sink.write(exc.type_name());
+        sink.put('"');
 
         // Source location
-        auto const & loc = exc.location();
-        std::format_to(std::back_inserter(result),
-                       R"(,"source":{{"file":"{}","line":{}}})",
-                       escape_json_string(loc.file_name()),
-                       loc.line());
+        if constexpr (source_info::enabled) {
+            auto const & loc = exc.location();
+            sink.write(R"(,"source":{"file":)");
+            write_json_string(sink, loc.file_name());
+            sink.write(R"(,"line":)");
+            sink.write_number(loc.line());
+            sink.put('}');
+        }
 
         // Data
         if (exc.size() > 0) {
-            result += R"(,"data":{)";
+            sink.write(R"(,"data":{)");
             bool first = true;
             for (auto const & [key, value] : exc) {
                 if (!first) {
-                    result += ',';
+                    sink.put(',');
                 }
                 first = false;
-                std::format_to(std::back_inserter(result),
-                               R"("{}":{})",
-                               escape_json_string(key),
-                               value_to_json(value));
+                write_json_string(sink, key.view());
+                sink.put(':');
+                write_json_value(sink, value);
             }
-            result += '}';
+            sink.put('}');
         }
 
-        result += '}';
+        // Propagation path carried over from a hinder::error
+        write_context_json(sink, exc.frames(), exc.dropped_frames());
+
+        // Stack trace
+        auto const frames = trace_frames(exc);
+        if (!frames.empty()) {
+            sink.write(R"(,"stack":[)");
+            bool first = true;
+            for (auto const & frame : frames) {
+                if (!first) {
+                    sink.put(',');
+                }
+                first = false;
+                sink.write(R"({"address":")");
+                sink.write_pointer(frame.address);
+                sink.write(R"(","symbol":)");
+                write_json_string(sink, frame.symbol);
+                sink.write(R"(,"object":)");
+                write_json_string(sink, frame.object);
+                sink.put('}');
+            }
+            sink.put(']');
+        }
+
+        sink.put('}');
+    }
+
+    auto detail::write_compact(format_sink & sink, exception const & exc) -> void {
+        // Header: type @file:line
+        sink.write(exc.type_name());
+        if constexpr (source_info::enabled) {
+            auto const & loc = exc.location();
+            sink.write(" @");
+            sink.write(loc.file_name());
+            sink.put(':');
+            sink.write_number(loc.line());
+        }
+
+        // key=value pairs on the same line; flag-style keys have no value
+        for (auto const & [key, value] : exc) {
+            sink.put(' ');
+            sink.write(key.view());
+            if (!std::holds_alternative<std::monostate>(value)) {
+                sink.put('=');
+                write_compact_value(sink, value);
+            }
+        }
+    }
+
+    auto to_string(exception const & exc) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        detail::write_string(sink, exc);
+        sink.flush();
+        return result;
+    }
+
+    auto to_json(exception const & exc) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        detail::write_json(sink, exc);
+        sink.flush();
+        return result;
+    }
+
+    auto to_string_to(std::span<char> buffer, exception const & exc) -> std::size_t {
+        format_sink sink(buffer);
+        detail::write_string(sink, exc);
+        sink.flush();
+        return sink.written();
+    }
+
+    auto to_json_to(std::span<char> buffer, exception const & exc) -> std::size_t {
+        format_sink sink(buffer);
+        detail::write_json(sink, exc);
+        sink.flush();
+        return sink.written();
+    }
+
+    // ========================================================================
+    // throw_site_stats
+    // ========================================================================
+
+    auto to_json(std::span<throw_site_stats const> stats) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        sink.put('[');
+        bool first = true;
+        for (auto const & site : stats) {
+            if (!first) {
+                sink.put(',');
+            }
+            first = false;
+            sink.write(R"({"type":")");
+            sink.write(site.type_name);
+            sink.put('"');
+            if constexpr (source_info::enabled) {
+                sink.write(R"(,"source":{"file":)");
+                detail::write_json_string(sink, site.location.file_name());
+                sink.write(R"(,"line":)");
+                sink.write_number(site.location.line());
+                sink.put('}');
+            }
+            sink.write(R"(,"count":)");
+            sink.write_number(site.count);
+            sink.write(R"(,"first_seen_ns":)");
+            sink.write_number(std::chrono::nanoseconds(site.first_seen.time_since_epoch()).count());
+            sink.write(R"(,"last_seen_ns":)");
+            sink.write_number(std::chrono::nanoseconds(site.last_seen.time_since_epoch()).count());
+            sink.put('}');
+        }
+        sink.put(']');
+        sink.flush();
         return result;
     }
 
@@ -0,0 +1,165 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/format_sink.h>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define HINDER_HAS_SIMD_ESCAPE 1
+    #include <immintrin.h>
+#endif  // __x86_64__ && (__GNUC__ || __clang__)
+
+namespace hinder {
+
+    namespace {
+
+        // Characters JSON requires to be escaped: '"', '\\' and the controls below ' '.
+        constexpr auto needs_escape(unsigned char chr) noexcept -> bool {
+            return chr < ' ' || chr == '"' || chr == '\\';
+        }
+
+        // Each scanner returns the index of the first character at or after from that needs
+        // escaping, or text.size() if there is none.
+        using scanner_t = std::size_t (*)(std::string_view text, std::size_t from) noexcept;
+
+        auto scan_scalar(std::string_view text, std::size_t from) noexcept -> std::size_t {
+            for (; from < text.size(); ++from) {
+                if (needs_escape(static_cast<unsigned char>(text[from]))) {
+                    break;
+                }
+            }
+            return from;
+        }
+
+#if defined(HINDER_HAS_SIMD_ESCAPE)
+
+        // SSE2 is part of x86-64, so this needs no runtime check.
+        auto scan_sse2(std::string_view text, std::size_t from) noexcept -> std::size_t {
+            auto const quote     = _mm_set1_epi8('"');
+            auto const backslash = _mm_set1_epi8('\\');
+            auto const control   = _mm_set1_epi8(' ' - 1);
+            for (; from + sizeof(__m128i) <= text.size(); from += sizeof(__m128i)) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): unaligned load
+                auto const chunk =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const *>(text.data() + from));
+                // chunk <= 0x1f unsigned, as min(chunk, 0x1f) == chunk
+                auto const hits = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                    _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+                auto const mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+                if (mask != 0) {
+                    return from + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+            return scan_scalar(text, from);
+        }
+
+        [[gnu::target("avx2")]]
+        auto scan_avx2(std::string_view text, std::size_t from) noexcept -> std::size_t {
+            auto const quote     = _mm256_set1_epi8('"');
+            auto const backslash = _mm256_set1_epi8('\\');
+            auto const control   = _mm256_set1_epi8(' ' - 1);
+            for (; from + sizeof(__m256i) <= text.size(); from += sizeof(__m256i)) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): unaligned load
+                auto const chunk =
+                    _mm256_loadu_si256(reinterpret_cast<__m256i const *>(text.data() + from));
+                auto const hits = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote),
+                                    _mm256_cmpeq_epi8(chunk, backslash)),
+                    _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, control), chunk));
+                auto const mask = static_cast<unsigned>(_mm256_movemask_epi8(hits));
+                if (mask != 0) {
+                    return from + static_cast<std::size_t>(std::countr_zero(mask));
+                }
+            }
+            // Finish a tail of 16 or more bytes with SSE2 before going scalar.
+            return scan_sse2(text, from);
+        }
+
+        auto select_scanner() noexcept -> scanner_t {
+            return __builtin_cpu_supports("avx2") ? scan_avx2 : scan_sse2;
+        }
+
+#else
+
+        auto select_scanner() noexcept -> scanner_t { return scan_scalar; }
+
+#endif  // HINDER_HAS_SIMD_ESCAPE
+
+        // Chosen once, on first use.
+        auto find_escape(std::string_view text, std::size_t from) noexcept -> std::size_t {
+            static scanner_t const scan = select_scanner();
+            return scan(text, from);
+        }
+
+    }  // namespace
+
+    auto detail::write_json_string(format_sink & sink, std::string_view text) -> void {
+        static constexpr std::array<char, 16> hex_digits {
+            '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+        sink.put('"');
+        // Copy each run of characters that need no escaping in one write.
+        std::size_t run = 0;
+        while (true) {
+            auto const idx = find_escape(text, run);
+            sink.write(text.substr(run, idx - run));
+            if (idx == text.size()) {
+                break;
+            }
+            auto const chr = static_cast<unsigned char>(text[idx]);
+            switch (chr) {
+            case '"':
+                sink.write("\\\"");
+                break;
+            case '\\':
+                sink.write("\\\\");
+                break;
+            case '\n':
+                sink.write("\\n");
+                break;
+            case '\r':
+                sink.write("\\r");
+                break;
+            case '\t':
+                sink.write("\\t");
+                break;
+            default:
+                sink.write("\\u00");
+                sink.put(hex_digits[chr >> 4U]);
+                sink.put(hex_digits[chr & 0xfU]);
+            }
+            run = idx + 1;
+        }
+        sink.put('"');
+    }
+
+}  // namespace hinder
@@ -0,0 +1,473 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/json_record.h>
+
+#include <hinder/exception/exception_data.h>
+#include <hinder/exception/exception_key.h>
+#include <hinder/exception/exception_value.h>
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <variant>
+
+namespace hinder {
+
+    namespace {
+
+        // Recursive descent over the to_json() schema. Each parse step returns false on failure,
+        // after recording the first error.
+        class record_parser {
+        public:
+            explicit record_parser(std::string_view json) : m_json(json) {}
+
+            auto parse() -> std::expected<error_record, record_parse_error> {
+                error_record record;
+                bool         has_type = false;
+                auto         member   = [&](std::string_view name) -> bool {
+                    if (name == "type") {
+                        auto const type = parse_string();
+                        if (!type) {
+                            return false;
+                        }
+                        record.type_name = *type;
+                        has_type         = true;
+                        return true;
+                    }
+                    if (name == "source") {
+                        return parse_object([&](std::string_view field) -> bool {
+                            return parse_source(field, record);
+                        });
+                    }
+                    if (name == "data") {
+                        return parse_object([&](std::string_view key) -> bool {
+                            return parse_value(key, record.data);
+                        });
+                    }
+                    return skip_value(0);
+                };
+
+                skip_whitespace();
+                if (!parse_object(member)) {
+                    return std::unexpected(m_error);
+                }
+                skip_whitespace();
+                if (m_pos != m_json.size()) {
+                    fail("unexpected text after the object");
+                    return std::unexpected(m_error);
+                }
+                if (!has_type) {
+                    return std::unexpected(record_parse_error {"missing \"type\"", 0});
+                }
+                return record;
+            }
+
+        private:
+            // Containers nested deeper than this are rejected rather than risk the stack.
+            static constexpr int max_depth = 64;
+
+            auto fail(char const * reason) -> bool {
+                m_error = {reason, m_pos};
+                return false;
+            }
+
+            [[nodiscard]] auto at_end() const -> bool { return m_pos >= m_json.size(); }
+            [[nodiscard]] auto peek() const -> char { return at_end() ? '\0' : m_json[m_pos]; }
+
+            auto skip_whitespace() -> void {
+                while (!at_end()) {
+                    auto const chr = m_json[m_pos];
+                    if (chr != ' ' && chr != '\n' && chr != '\r' && chr != '\t') {
+                        break;
+                    }
+                    ++m_pos;
+                }
+            }
+
+            auto expect(char chr) -> bool {
+                skip_whitespace();
+                if (peek() != chr) {
+                    return fail(chr == ':' ? "expected ':'" : "unexpected character");
+                }
+                ++m_pos;
+                return true;
+            }
+
+            // {"name": value, ...}, calling member(name) with the position at the value.
+            template <typename Member>
+            auto parse_object(Member && member) -> bool {
+                if (!expect('{')) {
+                    return false;
+                }
+                skip_whitespace();
+                if (peek() == '}') {
+                    ++m_pos;
+                    return true;
+                }
+                while (true) {
+                    skip_whitespace();
+                    auto name = parse_string();
+                    if (!name || !expect(':')) {
+                        return false;
+                    }
+                    // A name with escapes lives in m_scratch, which parsing the value may reuse.
+                    std::string unescaped;
+                    if (name->data() == m_scratch.data()) {
+                        unescaped = std::move(m_scratch);
+                        m_scratch.clear();
+                        name = unescaped;
+                    }
+                    skip_whitespace();
+                    if (!member(*name)) {
+                        return false;
+                    }
+                    skip_whitespace();
+                    if (peek() == ',') {
+                        ++m_pos;
+                        continue;
+                    }
+                    if (peek() == '}') {
+                        ++m_pos;
+                        return true;
+                    }
+                    return fail("expected ',' or '}'");
+                }
+            }
+
+            auto parse_source(std::string_view field, error_record & record) -> bool {
+                if (field == "file") {
+                    auto const file = parse_string();
+                    if (!file) {
+                        return false;
+                    }
+                    record.file = *file;
+                    return true;
+                }
+                if (field == "line") {
+                    auto const start = m_pos;
+                    auto const token = number_token();
+                    auto const [ptr, ec] =
+                        std::from_chars(token.data(), token.data() + token.size(), record.line);
+                    if (token.empty() || ec != std::errc {} || ptr != token.data() + token.size()) {
+                        m_pos = start;
+                        return fail("invalid line number");
+                    }
+                    return true;
+                }
+                return skip_value(1);
+            }
+
+            auto parse_value(std::string_view key, exception_data & data) -> bool {
+                switch (peek()) {
+                case '"': {
+                    auto const text = parse_string();
+                    if (!text) {
+                        return false;
+                    }
+                    data.set(exception_key(key), std::string(*text));
+                    return true;
+                }
+                case 't':
+                case 'f':
+                case 'n': {
+                    auto const literal = parse_literal();
+                    if (!literal) {
+                        return false;
+                    }
+                    data.set(exception_key(key), *literal);
+                    return true;
+                }
+                default: {
+                    auto const number = parse_number();
+                    if (!number) {
+                        return false;
+                    }
+                    data.set(exception_key(key), *number);
+                    return true;
+                }
+                }
+            }
+
+            // true, false or null (a flag).
+            auto parse_literal() -> std::optional<exception_value> {
+                auto const rest = m_json.substr(m_pos);
+                if (rest.starts_with("true")) {
+                    m_pos += 4;
+                    return true;
+                }
+                if (rest.starts_with("false")) {
+                    m_pos += 5;
+                    return false;
+                }
+                if (rest.starts_with("null")) {
+                    m_pos += 4;
+                    return std::monostate {};
+                }
+                fail("invalid literal");
+                return std::nullopt;
+            }
+
+            // The characters that can make up a JSON number; from_chars checks the rest.
+            auto number_token() -> std::string_view {
+                auto const start = m_pos;
+                while (!at_end()) {
+                    auto const chr = m_json[m_pos];
+                    if ((chr < '0' || chr > '9') && chr != '-' && chr != '+' && chr != '.'
+                        && chr != 'e' && chr != 'E') {
+                        break;
+                    }
+                    ++m_pos;
+                }
+                return m_json.substr(start, m_pos - start);
+            }
+
+            auto parse_number() -> std::optional<exception_value> {
+                auto const start = m_pos;
+                auto const token = number_token();
+                if (token.empty()) {
+                    fail("unexpected character");
+                    return std::nullopt;
+                }
+                auto const * const first = token.data();
+                auto const * const last  = token.data() + token.size();
+
+                if (token.find_first_of(".eE") == std::string_view::npos) {
+                    std::int64_t signed_value {};
+                    auto const   as_signed = std::from_chars(first, last, signed_value);
+                    if (as_signed.ec == std::errc {} && as_signed.ptr == last) {
+                        return signed_value;
+                    }
+                    std::uint64_t unsigned_value {};
+                    auto const    as_unsigned = std::from_chars(first, last, unsigned_value);
+                    if (as_unsigned.ec == std::errc {} && as_unsigned.ptr == last) {
+                        return unsigned_value;
+                    }
+                }
+                double     real {};
+                auto const as_real = std::from_chars(first, last, real);
+                if (as_real.ec != std::errc {} || as_real.ptr != last) {
+                    m_pos = start;
+                    fail("invalid number");
+                    return std::nullopt;
+                }
+                return real;
+            }
+
+            // A string value. Points into the input when it has no escapes, else into m_scratch,
+            // so it is valid until the next call.
+            auto parse_string() -> std::optional<std::string_view> {
+                if (peek() != '"') {
+                    fail("expected a string");
+                    return std::nullopt;
+                }
+                auto const start = ++m_pos;
+                auto const stop  = m_json.find_first_of("\"\\", start);
+                if (stop == std::string_view::npos) {
+                    m_pos = m_json.size();
+                    fail("unterminated string");
+                    return std::nullopt;
+                }
+                if (m_json[stop] == '"') {
+                    m_pos = stop + 1;
+                    return m_json.substr(start, stop - start);
+                }
+
+                m_scratch.assign(m_json.substr(start, stop - start));
+                m_pos = stop;
+                while (true) {
+                    auto const next = m_json.find_first_of("\"\\", m_pos);
+                    if (next == std::string_view::npos) {
+                        m_pos = m_json.size();
+                        fail("unterminated string");
+                        return std::nullopt;
+                    }
+                    m_scratch.append(m_json.substr(m_pos, next - m_pos));
+                    m_pos = next + 1;
+                    if (m_json[next] == '"') {
+                        return std::string_view(m_scratch);
+                    }
+                    if (!parse_escape()) {
+                        return std::nullopt;
+                    }
+                }
+            }
+
+            // The escape after a backslash, appended to m_scratch.
+            auto parse_escape() -> bool {
+                auto const chr = peek();
+                ++m_pos;
+                switch (chr) {
+                case '"':
+                case '\\':
+                case '/':
+                    m_scratch += chr;
+                    return true;
+                case 'b':
+                    m_scratch += '\b';
+                    return true;
+                case 'f':
+                    m_scratch += '\f';
+                    return true;
+                case 'n':
+                    m_scratch += '\n';
+                    return true;
+                case 'r':
+                    m_scratch += '\r';
+                    return true;
+                case 't':
+                    m_scratch += '\t';
+                    return true;
+                case 'u':
+                    return parse_unicode_escape();
+                default:
+                    --m_pos;
+                    return fail("invalid escape");
+                }
+            }
+
+            auto parse_hex4() -> std::optional<std::uint32_t> {
+                std::uint32_t value {};
+                auto const    digits = m_json.substr(m_pos, 4);
+                auto const [ptr, ec] =
+                    std::from_chars(digits.data(), digits.data() + digits.size(), value, 16);
+                if (digits.size() != 4 || ec != std::errc {} || ptr != digits.data() + 4) {
+                    fail("invalid unicode escape");
+                    return std::nullopt;
+                }
+                m_pos += 4;
+                return value;
+            }
+
+            // \uXXXX, or a surrogate pair \uD8XX\uDCXX, as UTF-8.
+            auto parse_unicode_escape() -> bool {
+                auto code = parse_hex4();
+                if (!code) {
+                    return false;
+                }
+                if (*code >= 0xd800U && *code <= 0xdbffU) {
+                    if (m_json.substr(m_pos, 2) != "\\u") {
+                        return fail("unpaired surrogate");
+                    }
+                    m_pos += 2;
+                    auto const low = parse_hex4();
+                    if (!low) {
+                        return false;
+                    }
+                    if (*low < 0xdc00U || *low > 0xdfffU) {
+                        return fail("unpaired surrogate");
+                    }
+                    *code = 0x10000U + ((*code - 0xd800U) << 10U) + (*low - 0xdc00U);
+                } else if (*code >= 0xdc00U && *code <= 0xdfffU) {
+                    return fail("unpaired surrogate");
+                }
+
+                auto const put = [this](std::uint32_t byte) -> void {
+                    m_scratch += static_cast<char>(byte);
+                };
+                if (*code < 0x80U) {
+                    put(*code);
+                } else if (*code < 0x800U) {
+                    put(0xc0U | (*code >> 6U));
+                    put(0x80U | (*code & 0x3fU));
+                } else if (*code < 0x10000U) {
+                    put(0xe0U | (*code >> 12U));
+                    put(0x80U | ((*code >> 6U) & 0x3fU));
+                    put(0x80U | (*code & 0x3fU));
+                } else {
+                    put(0xf0U | (*code >> 18U));
+                    put(0x80U | ((*code >> 12U) & 0x3fU));
+                    put(0x80U | ((*code >> 6U) & 0x3fU));
+                    put(0x80U | (*code & 0x3fU));
+                }
+                return true;
+            }
+
+            // Any JSON value, discarded: members the record has no place for.
+            auto skip_value(int depth) -> bool {
+                if (depth > max_depth) {
+                    return fail("nesting too deep");
+                }
+                skip_whitespace();
+                switch (peek()) {
+                case '"':
+                    return parse_string().has_value();
+                case '{':
+                    return parse_object(
+                        [&](std::string_view /*name*/) -> bool { return skip_value(depth + 1); });
+                case '[': {
+                    ++m_pos;
+                    skip_whitespace();
+                    if (peek() == ']') {
+                        ++m_pos;
+                        return true;
+                    }
+                    while (true) {
+                        if (!skip_value(depth + 1)) {
+                            return false;
+                        }
+                        skip_whitespace();
+                        if (peek() == ',') {
+                            ++m_pos;
+                            continue;
+                        }
+                        if (peek() == ']') {
+                            ++m_pos;
+                            return true;
+                        }
+                        return fail("expected ',' or ']'");
+                    }
+                }
+                case 't':
+                case 'f':
+                case 'n':
+                    return parse_literal().has_value();
+                default:
+                    return parse_number().has_value();
+                }
+            }
+
+            std::string_view   m_json;
+            std::size_t        m_pos {0};
+            std::string        m_scratch;  // unescaped text of the last string with escapes
+            record_parse_error m_error {"", 0};
+        };
+
+    }  // namespace
+
+    auto parse_json_record(std::string_view json)
+        -> std::expected<error_record, record_parse_error> {
+        return record_parser(json).parse();
+    }
+
+}  // namespace hinder
@@ -0,0 +1,121 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/stack_trace.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__) && __has_include(<unwind.h>) && __has_include(<dlfcn.h>)
+    #define HINDER_HAS_UNWIND 1
+    #include <cxxabi.h>
+    #include <dlfcn.h>
+    #include <unwind.h>
+#endif  // __GNUC__ && <unwind.h> && <dlfcn.h>
+
+namespace hinder {
+
+#if defined(HINDER_HAS_UNWIND)
+
+    namespace {
+
+        struct unwind_state {
+            void **     frames;
+            std::size_t size;
+            std::size_t skip;
+        };
+
+        auto collect(_Unwind_Context * ctx, void * arg) -> _Unwind_Reason_Code {
+            auto *     state = static_cast<unwind_state *>(arg);
+            auto const ip    = _Unwind_GetIP(ctx);
+            if (ip == 0) {
+                return _URC_END_OF_STACK;
+            }
+            if (state->skip > 0) {
+                --state->skip;
+                return _URC_NO_REASON;
+            }
+            if (state->size == stack_trace::max_frames) {
+                return _URC_END_OF_STACK;
+            }
+            // NOLINTNEXTLINE(performance-no-int-to-ptr, *-reinterpret-cast)
+            state->frames[state->size++] = reinterpret_cast<void *>(ip);
+            return _URC_NO_REASON;
+        }
+
+        auto demangle(char const * name) -> std::string {
+            int  status = 0;
+            auto owned  = std::unique_ptr<char, decltype(&std::free)>(
+                abi::__cxa_demangle(name, nullptr, nullptr, &status), &std::free);
+            return status == 0 && owned ? std::string(owned.get()) : std::string(name);
+        }
+
+    }  // namespace
+
+    auto stack_trace::capture(std::size_t skip) noexcept -> stack_trace {
+        stack_trace  trace;
+        unwind_state state {trace.m_frames.data(), 0, skip + 1};  // + 1: capture() itself
+        _Unwind_Backtrace(&collect, &state);
+        trace.m_size = state.size;
+        return trace;
+    }
+
+    auto stack_trace::symbolize() const -> std::vector<frame> {
+        std::vector<frame> result;
+        result.reserve(m_size);
+        for (auto const * address : addresses()) {
+            frame   current {address, {}, {}};
+            Dl_info info {};
+            // Look up address - 1: a return address may already belong to the next function.
+            auto const lookup = reinterpret_cast<std::uintptr_t>(address) - 1;  // NOLINT
+            // NOLINTNEXTLINE(performance-no-int-to-ptr, *-reinterpret-cast)
+            if (dladdr(reinterpret_cast<void const *>(lookup), &info) != 0) {
+                if (info.dli_sname != nullptr) {
+                    current.symbol = demangle(info.dli_sname);
+                }
+                if (info.dli_fname != nullptr) {
+                    current.object = info.dli_fname;
+                }
+            }
+            result.push_back(std::move(current));
+        }
+        return result;
+    }
+
+#else
+
+    auto stack_trace::capture(std::size_t /*skip*/) noexcept -> stack_trace { return {}; }
+
+    auto stack_trace::symbolize() const -> std::vector<frame> { return {}; }
+
+#endif  // HINDER_HAS_UNWIND
+
+}  // namespace hinder
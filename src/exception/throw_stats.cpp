@@ -0,0 +1,181 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/throw_stats.h>
+
+#include <hinder/exception/exception.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+namespace hinder {
+
+    namespace {
+
+        // splitmix64 finalizer: spreads aligned addresses and small line numbers over all bits.
+        constexpr auto mix(std::uint64_t value) noexcept -> std::uint64_t {
+            value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9U;
+            value = (value ^ (value >> 27U)) * 0x94d049bb133111ebU;
+            return value ^ (value >> 31U);
+        }
+
+        // Throttle key for the site exc was thrown from. 0 is reserved for an empty slot.
+        auto site_key(exception const & exc) noexcept -> std::uint64_t {
+            std::uint64_t key = 0;
+            if (auto const * site = exc.site(); site != nullptr) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                key = mix(reinterpret_cast<std::uintptr_t>(site));
+            } else {
+                // The addresses of the site's static strings, and its line.
+                auto const & loc = exc.location();
+                // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+                key = mix(reinterpret_cast<std::uintptr_t>(exc.type_name().data()));
+                key = mix(key ^ reinterpret_cast<std::uintptr_t>(loc.file_name()));
+                // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+                key = mix(key ^ loc.line());
+            }
+            return key == 0 ? 1 : key;
+        }
+
+        // Head of the registry: a lock-free push-only list of every site that has thrown.
+        auto registry_head() noexcept -> std::atomic<throw_site_counter *> & {
+            static std::atomic<throw_site_counter *> head {nullptr};
+            return head;
+        }
+
+    }  // namespace
+
+    throw_site_counter::throw_site_counter(std::string_view     type_name,
+                                           std::source_location loc) noexcept
+    : m_type_name(type_name),
+      m_location(loc) {
+        auto & head = registry_head();
+        m_next      = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(
+            m_next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    auto throw_site_counter::record() noexcept -> void {
+        auto const now = clock_t::now().time_since_epoch().count();
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        std::int64_t never = 0;
+        m_first_seen.compare_exchange_strong(never, now, std::memory_order_relaxed);
+        m_last_seen.store(now, std::memory_order_relaxed);
+    }
+
+    auto collect_throw_stats() -> std::vector<throw_site_stats> {
+        using time_point = throw_site_stats::time_point;
+        using duration   = time_point::duration;
+
+        std::vector<throw_site_stats> result;
+        for (auto const * site = registry_head().load(std::memory_order_acquire); site != nullptr;
+             site              = site->m_next) {
+            auto const count = site->m_count.load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            result.push_back({
+                site->m_type_name,
+                site->m_location,
+                count,
+                time_point(duration(site->m_first_seen.load(std::memory_order_relaxed))),
+                time_point(duration(site->m_last_seen.load(std::memory_order_relaxed))),
+            });
+        }
+        std::ranges::stable_sort(result, std::ranges::greater {}, &throw_site_stats::count);
+        return result;
+    }
+
+    auto reset_throw_stats() noexcept -> void {
+        for (auto * site = registry_head().load(std::memory_order_acquire); site != nullptr;
+             site        = site->m_next) {
+            site->m_count.store(0, std::memory_order_relaxed);
+            site->m_first_seen.store(0, std::memory_order_relaxed);
+            site->m_last_seen.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    auto log_throttle::admit(exception const & exc) noexcept -> std::optional<std::uint64_t> {
+        auto const site = site_key(exc);
+        auto const now  = clock_t::now().time_since_epoch().count();
+        auto const next = now + m_interval.count();
+
+        // The two candidate slots come from independent bits of the key.
+        std::array<slot_t *, 2> const slots {&m_slots[site % slot_count],
+                                             &m_slots[(site >> 32U) % slot_count]};
+        for (auto * slot : slots) {
+            if (slot->site.load(std::memory_order_acquire) == site) {
+                return throttle(*slot, now, next);
+            }
+        }
+
+        // Not tracked yet: take a free candidate.
+        for (auto * slot : slots) {
+            std::uint64_t owner = 0;
+            if (slot->site.compare_exchange_strong(owner, site, std::memory_order_acq_rel)) {
+                return claim(*slot, next);
+            }
+            if (owner == site) {
+                return throttle(*slot, now, next);  // another thread claimed it for this site
+            }
+        }
+
+        // Both are held by other sites: take over the one admitted least recently.
+        auto * victim = slots[0]->next_admit.load(std::memory_order_relaxed)
+                                <= slots[1]->next_admit.load(std::memory_order_relaxed)
+                            ? slots[0]
+                            : slots[1];
+        victim->site.store(site, std::memory_order_release);
+        return claim(*victim, next);
+    }
+
+    auto log_throttle::claim(slot_t & slot, std::int64_t next) noexcept
+        -> std::optional<std::uint64_t> {
+        slot.next_admit.store(next, std::memory_order_relaxed);
+        slot.suppressed.store(0, std::memory_order_relaxed);
+        return 0;
+    }
+
+    auto log_throttle::throttle(slot_t & slot, std::int64_t now, std::int64_t next) noexcept
+        -> std::optional<std::uint64_t> {
+        auto due = slot.next_admit.load(std::memory_order_relaxed);
+        if (now >= due
+            && slot.next_admit.compare_exchange_strong(due, next, std::memory_order_relaxed)) {
+            return slot.suppressed.exchange(0, std::memory_order_relaxed);
+        }
+        slot.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+}  // namespace hinder
@@ -0,0 +1,48 @@
+//
+// hinder::error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/exception_value.h>
+
+#include <hinder/expected/bridge.h>
+
+#include <memory>
+#include <string>
+
+namespace hinder {
+
+    error_exception::error_exception(error const & err)
+    : m_type_name(std::make_shared<std::string const>(err.type_name())) {
+        set_type_name(m_type_name->c_str());
+        adopt_impl(err.location(), err.data());
+    }
+
+    auto to_error(exception const & exc) -> error {
+        return {exc.type_name(), exc.location(), exc.data()};
+    }
+
+    auto throw_error(error const & err) -> void { throw error_exception(err); }
+
+}  // namespace hinder
@@ -0,0 +1,141 @@
+//
+// hinder::error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/exception_value.h>
+
+#include <hinder/expected/compact_error.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace hinder {
+
+    namespace {
+
+        // What a moved-from compact_error refers to.
+        constexpr error_descriptor moved_from_descriptor {"error"};
+
+        auto bits_of(error_descriptor const & desc) noexcept -> std::uintptr_t {
+            return reinterpret_cast<std::uintptr_t>(&desc);  // NOLINT(*-reinterpret-cast)
+        }
+
+    }  // namespace
+
+    struct compact_error::block {
+        explicit block(error err) noexcept : value(std::move(err)) {}
+
+        std::atomic<std::size_t> refs {1};
+        error                    value;
+    };
+
+    compact_error::compact_error(error_descriptor const & desc) noexcept
+    : m_bits(bits_of(desc)) {}
+
+    compact_error::compact_error(error err)
+    // NOLINTNEXTLINE(*-reinterpret-cast, cppcoreguidelines-owning-memory)
+    : m_bits(reinterpret_cast<std::uintptr_t>(new block(std::move(err))) | heap_tag) {
+        static_assert(alignof(error_descriptor) > 1 && alignof(block) > 1,
+                      "the low pointer bit is used as the tag");
+    }
+
+    compact_error::~compact_error() { release(); }
+
+    compact_error::compact_error(compact_error const & other) noexcept
+    : m_bits(other.m_bits) {
+        if (auto * shared = heap()) {
+            shared->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    auto compact_error::operator=(compact_error const & other) noexcept -> compact_error & {
+        if (m_bits != other.m_bits) {
+            compact_error copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    compact_error::compact_error(compact_error && other) noexcept
+    : m_bits(std::exchange(other.m_bits, bits_of(moved_from_descriptor))) {}
+
+    auto compact_error::operator=(compact_error && other) noexcept -> compact_error & {
+        if (this != &other) {
+            release();
+            m_bits = std::exchange(other.m_bits, bits_of(moved_from_descriptor));
+        }
+        return *this;
+    }
+
+    auto compact_error::type_name() const noexcept -> std::string_view {
+        if (auto const * desc = descriptor()) {
+            return desc->type_name;
+        }
+        return heap()->value.type_name();
+    }
+
+    auto compact_error::location() const noexcept -> source_info const & {
+        if (auto const * desc = descriptor()) {
+            return desc->location;
+        }
+        return heap()->value.location();
+    }
+
+    auto compact_error::to_error() const -> error {
+        if (auto const * desc = descriptor()) {
+            error err(desc->type_name, desc->location);
+            if (!desc->message.empty()) {
+                err.with("message", desc->message);
+            }
+            return err;
+        }
+        return heap()->value;
+    }
+
+    auto compact_error::descriptor() const noexcept -> error_descriptor const * {
+        // NOLINTNEXTLINE(performance-no-int-to-ptr, *-reinterpret-cast): untagging
+        return is_static() ? reinterpret_cast<error_descriptor const *>(m_bits) : nullptr;
+    }
+
+    auto compact_error::heap() const noexcept -> block * {
+        // NOLINTNEXTLINE(performance-no-int-to-ptr, *-reinterpret-cast): untagging
+        return is_static() ? nullptr : reinterpret_cast<block *>(m_bits & ~heap_tag);
+    }
+
+    auto compact_error::release() noexcept -> void {
+        auto * shared = heap();
+        if (shared != nullptr && shared->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete shared;  // NOLINT(cppcoreguidelines-owning-memory)
+        }
+    }
+
+    auto to_string(compact_error const & err) -> std::string { return to_string(err.to_error()); }
+
+    auto to_json(compact_error const & err) -> std::string { return to_json(err.to_error()); }
+
+}  // namespace hinder
@@ -27,21 +27,53 @@
 #include <hinder/exception/exception_value.h>
 #include <hinder/expected/error.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <source_location>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <variant>
 
 namespace hinder {
 
+    namespace detail {
+
+        error_type_name::error_type_name(std::string_view name) {
+            if (name.size() > inline_capacity) {
+                m_shared = std::make_shared<std::string const>(name);
+                return;
+            }
+            std::ranges::copy(name, m_inline.begin());
+            m_size = static_cast<std::uint8_t>(name.size());
+        }
+
+    }  // namespace detail
+
     error::error(std::string_view type_name, std::source_location loc)
     : m_type_name(type_name),
       m_location(loc) {}
 
-    auto error::with(std::string_view key) -> error & {
-        m_data[std::string(key)] = std::monostate {};
+    error::error(std::string_view type_name, source_info loc)
+    : m_type_name(type_name),
+      m_location(loc) {}
+
+    error::error(std::string_view type_name, source_info loc, data_map data)
+    : m_type_name(type_name),
+      m_location(loc),
+      m_data(std::move(data)) {}
+
+    auto error::with(exception_key key) -> error & {
+        m_data.set(std::move(key), std::monostate {});
+        return *this;
+    }
+
+    auto error::with_frame(char const * note, std::source_location loc) -> error & {
+        m_data.add_frame(context_frame {source_info {loc}, note});
         return *this;
     }
 
@@ -53,8 +85,13 @@ namespace hinder {
         return iter->second;
     }
 
+    auto error::get_ref(std::string_view key) const -> exception_value const * {
+        auto iter = m_data.find(key);
+        return iter == m_data.end() ? nullptr : &iter->second;
+    }
+
     auto error::contains(std::string_view key) const -> bool {
-        return m_data.find(key) != m_data.end();
+        return m_data.contains(key);
     }
 
     auto error::begin() const -> const_iterator { return m_data.begin(); }
@@ -63,9 +100,17 @@ namespace hinder {
 
     auto error::size() const -> std::size_t { return m_data.size(); }
 
-    auto error::type_name() const -> std::string_view { return m_type_name; }
+    auto error::data() const noexcept -> data_map const & { return m_data; }
+
+    auto error::frames() const noexcept -> std::span<context_frame const> {
+        return m_data.frames();
+    }
+
+    auto error::dropped_frames() const noexcept -> std::size_t { return m_data.dropped_frames(); }
+
+    auto error::type_name() const -> std::string_view { return m_type_name.view(); }
 
-    auto error::location() const -> std::source_location const & { return m_location; }
+    auto error::location() const -> source_info const & { return m_location; }
 
     auto fail(std::string_view type_name, std::source_location loc) -> error_builder {
         return error_builder(error(type_name, loc));
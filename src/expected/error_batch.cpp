@@ -0,0 +1,221 @@
+//
+// hinder::error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/exception/exception_value.h>
+#include <hinder/expected/error_batch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace hinder {
+
+    auto error_batch::push_back(error const & err) -> std::size_t {
+        auto const row = start_row(err.type_name(), err.location());
+        for (auto const & [key, value] : err) {
+            std::visit(
+                [this, key = key.view()](auto const & val) -> void {
+                    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(val)>, std::string>) {
+                        append(key, std::string_view(val));
+                    } else {
+                        append(key, val);
+                    }
+                },
+                value);
+        }
+        return row;
+    }
+
+    auto error_batch::add(std::string_view type_name, std::source_location loc) -> row_builder {
+        return {this, start_row(type_name, source_info {loc})};
+    }
+
+    auto error_batch::reserve(std::size_t rows, std::size_t entries) -> void {
+        m_types.reserve(rows);
+        m_locations.reserve(rows);
+        m_row_begin.reserve(rows + 1);
+        m_keys.reserve(entries);
+        m_kinds.reserve(entries);
+        m_slots.reserve(entries);
+    }
+
+    auto error_batch::clear() noexcept -> void {
+        m_types.clear();
+        m_locations.clear();
+        m_row_begin.resize(1);
+        m_keys.clear();
+        m_kinds.clear();
+        m_slots.clear();
+        m_ints.clear();
+        m_uints.clear();
+        m_reals.clear();
+        m_text.clear();
+        m_text_begin.resize(1);
+    }
+
+    auto error_batch::operator[](std::size_t row) const -> row_view { return {this, row}; }
+
+    auto error_batch::intern(std::string_view name) -> std::uint32_t {
+        if (auto iter = m_ids.find(name); iter != m_ids.end()) {
+            return iter->second;
+        }
+        auto const id = static_cast<std::uint32_t>(m_names.size());
+        auto const [iter, inserted] = m_ids.emplace(std::string(name), id);
+        m_names.push_back(&iter->first);
+        return id;
+    }
+
+    auto error_batch::start_row(std::string_view type_name, source_info loc) -> std::size_t {
+        m_types.push_back(intern(type_name));
+        m_locations.push_back(loc);
+        m_row_begin.push_back(m_row_begin.back());
+        return m_types.size() - 1;
+    }
+
+    auto error_batch::append(std::string_view key, value_view value) -> void {
+        auto const key_id = intern(key);
+        std::visit(
+            [this, key_id](auto const & val) -> void {
+                using val_type = std::remove_cvref_t<decltype(val)>;
+
+                if constexpr (std::is_same_v<val_type, std::monostate>) {
+                    append_entry(key_id, kind::flag, 0);
+                } else if constexpr (std::is_same_v<val_type, bool>) {
+                    append_entry(key_id, kind::boolean, val ? 1 : 0);
+                } else if constexpr (std::is_same_v<val_type, std::int64_t>) {
+                    m_ints.push_back(val);
+                    append_entry(key_id, kind::int64, m_ints.size() - 1);
+                } else if constexpr (std::is_same_v<val_type, std::uint64_t>) {
+                    m_uints.push_back(val);
+                    append_entry(key_id, kind::uint64, m_uints.size() - 1);
+                } else if constexpr (std::is_same_v<val_type, double>) {
+                    m_reals.push_back(val);
+                    append_entry(key_id, kind::real, m_reals.size() - 1);
+                } else {
+                    m_text.append(val);
+                    m_text_begin.push_back(m_text.size());
+                    append_entry(key_id, kind::text, m_text_begin.size() - 2);
+                }
+            },
+            value);
+    }
+
+    auto error_batch::append_text(std::string_view key) -> void {
+        // Strings are only ever appended, so the new one starts where the last one ended.
+        m_text_begin.push_back(m_text.size());
+        append_entry(intern(key), kind::text, m_text_begin.size() - 2);
+    }
+
+    auto error_batch::append_entry(std::uint32_t key, kind knd, std::size_t slot) -> void {
+        auto const slot32 = static_cast<std::uint32_t>(slot);
+        auto const name   = *m_names[key];
+
+        // The last row is the tail of the entry columns, so inserting shifts only its entries.
+        std::size_t entry = m_row_begin[m_types.size() - 1];
+        for (; entry < m_keys.size(); ++entry) {
+            if (m_keys[entry] == key) {
+                m_kinds[entry] = knd;
+                m_slots[entry] = slot32;
+                return;
+            }
+            if (key_at(entry) > name) {
+                break;
+            }
+        }
+        auto const offset = static_cast<std::ptrdiff_t>(entry);
+        m_keys.insert(m_keys.begin() + offset, key);
+        m_kinds.insert(m_kinds.begin() + offset, knd);
+        m_slots.insert(m_slots.begin() + offset, slot32);
+        m_row_begin.back() = static_cast<std::uint32_t>(m_keys.size());
+    }
+
+    auto error_batch::value_at(std::size_t entry) const -> value_view {
+        auto const slot = m_slots[entry];
+        switch (m_kinds[entry]) {
+        case kind::flag:
+            return std::monostate {};
+        case kind::boolean:
+            return slot != 0;
+        case kind::int64:
+            return m_ints[slot];
+        case kind::uint64:
+            return m_uints[slot];
+        case kind::real:
+            return m_reals[slot];
+        case kind::text:
+            return std::string_view(m_text).substr(m_text_begin[slot],
+                                                   m_text_begin[slot + 1] - m_text_begin[slot]);
+        }
+        return std::monostate {};
+    }
+
+    // ========================================================================
+    // row_view
+    // ========================================================================
+
+    auto error_batch::row_view::type_name() const -> std::string_view {
+        return *m_batch->m_names[m_batch->m_types[m_row]];
+    }
+
+    auto error_batch::row_view::location() const -> source_info const & {
+        return m_batch->m_locations[m_row];
+    }
+
+    auto error_batch::row_view::get(std::string_view key) const -> std::optional<value_view> {
+        for (auto entry = first(); entry < last(); ++entry) {
+            if (m_batch->key_at(entry) == key) {
+                return m_batch->value_at(entry);
+            }
+        }
+        return std::nullopt;
+    }
+
+    auto error_batch::row_view::contains(std::string_view key) const -> bool {
+        return get(key).has_value();
+    }
+
+    auto error_batch::row_view::to_error() const -> error {
+        error err(type_name(), location());
+        for (auto const & [key, value] : *this) {
+            std::visit(
+                [&err, key](auto const & val) -> void {
+                    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(val)>,
+                                                 std::monostate>) {
+                        err.with(key);
+                    } else {
+                        err.with(key, val);
+                    }
+                },
+                value);
+        }
+        return err;
+    }
+
+}  // namespace hinder
@@ -24,129 +24,207 @@
 // SOFTWARE.
 //
 
-#include <hinder/exception/exception_value.h>
 #include <hinder/expected/error.h>
-
-#include <format>
-#include <iterator>
+#include <hinder/expected/error_batch.h>
+#include <hinder/exception/binary.h>
+#include <hinder/exception/format_sink.h>
+#include <hinder/exception/json_record.h>
+
+#include <cstddef>
+#include <expected>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 namespace hinder {
 
     namespace {
 
-        auto escape_json_string(std::string_view input) -> std::string {
-            std::string result;
-            result.reserve(input.size());
-            for (char chr : input) {
-                switch (chr) {
-                case '"':
-                    result += "\\\"";
-                    break;
-                case '\\':
-                    result += "\\\\";
-                    break;
-                case '\n':
-                    result += "\\n";
-                    break;
-                case '\r':
-                    result += "\\r";
-                    break;
-                case '\t':
-                    result += "\\t";
-                    break;
-                default:
-                    if (static_cast<unsigned char>(chr) < ' ') {
-                        std::format_to(std::back_inserter(result),
-                                       "\\u{:04x}",
-                                       static_cast<unsigned>(chr));
-                    } else {
-                        result += chr;
+        auto key_view(exception_key const & key) -> std::string_view { return key.view(); }
+        auto key_view(std::string_view key) -> std::string_view { return key; }
+
+        // JSON object for an error or an error_batch row.
+        template <typename Error>
+        auto write_object(format_sink & sink, Error const & err) -> void {
+            // Type
+            sink.write(R"({"type":")");
+            sink.write(err.type_name());
+            sink.put('"');
+
+            // Source location
+            if constexpr (source_info::enabled) {
+                auto const & loc = err.location();
+                sink.write(R"(,"source":{"file":)");
+                detail::write_json_string(sink, loc.file_name());
+                sink.write(R"(,"line":)");
+                sink.write_number(loc.line());
+                sink.put('}');
+            }
+
+            // Data
+            if (err.size() > 0) {
+                sink.write(R"(,"data":{)");
+                bool first = true;
+                for (auto const & [key, value] : err) {
+                    if (!first) {
+                        sink.put(',');
                     }
+                    first = false;
+                    detail::write_json_string(sink, key_view(key));
+                    sink.put(':');
+                    detail::write_json_value(sink, value);
                 }
+                sink.put('}');
             }
-            return result;
-        }
 
-        auto value_to_json(exception_value const & val) -> std::string {
-            return std::visit(
-                [](auto const & val) -> std::string {
-                    using T = std::remove_cvref_t<decltype(val)>;
-
-                    if constexpr (std::is_same_v<T, std::monostate>) {
-                        return "null";
-                    } else if constexpr (std::is_same_v<T, bool>) {
-                        return val ? "true" : "false";
-                    } else if constexpr (std::is_same_v<T, std::string>) {
-                        return std::format("\"{}\"", escape_json_string(val));
-                    } else {
-                        return std::format("{}", val);
-                    }
-                },
-                val);
+            // Propagation path recorded by HINDER_TRY
+            if constexpr (std::is_same_v<Error, error>) {
+                detail::write_context_json(sink, err.frames(), err.dropped_frames());
+            }
+
+            sink.put('}');
         }
 
     }  // namespace
 
-    auto to_string(error const & err) -> std::string {
-        std::string result;
-
+    auto detail::write_string(format_sink & sink, error const & err) -> void {
         // Header: type @file:line
-        auto const & loc = err.location();
-        std::format_to(std::back_inserter(result),
-                       "{} @{}:{}",
-                       err.type_name(),
-                       loc.file_name(),
-                       loc.line());
+        sink.write(err.type_name());
+        if constexpr (source_info::enabled) {
+            auto const & loc = err.location();
+            sink.write(" @");
+            sink.write(loc.file_name());
+            sink.put(':');
+            sink.write_number(loc.line());
+        }
 
         // Key-value pairs, indented
         for (auto const & [key, value] : err) {
-            auto val_str = value_to_string(value);
-            if (val_str.empty()) {
-                std::format_to(std::back_inserter(result), "\n  {}", key);
-            } else {
-                std::format_to(std::back_inserter(result), "\n  {}: {}", key, val_str);
+            sink.write("\n  ");
+            sink.write(key.view());
+            if (!is_bare_key(value)) {
+                sink.write(": ");
+                write_value(sink, value);
+            }
+        }
+
+        // Propagation path recorded by HINDER_TRY
+        write_context_string(sink, err.frames(), err.dropped_frames());
+    }
+
+    auto detail::write_json(format_sink & sink, error const & err) -> void {
+        write_object(sink, err);
+    }
+
+    auto detail::write_compact(format_sink & sink, error const & err) -> void {
+        // Header: type @file:line
+        sink.write(err.type_name());
+        if constexpr (source_info::enabled) {
+            auto const & loc = err.location();
+            sink.write(" @");
+            sink.write(loc.file_name());
+            sink.put(':');
+            sink.write_number(loc.line());
+        }
+
+        // key=value pairs on the same line; flag-style keys have no value
+        for (auto const & [key, value] : err) {
+            sink.put(' ');
+            sink.write(key.view());
+            if (!std::holds_alternative<std::monostate>(value)) {
+                sink.put('=');
+                write_compact_value(sink, value);
             }
         }
+    }
 
+    auto to_string(error const & err) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        detail::write_string(sink, err);
+        sink.flush();
         return result;
     }
 
     auto to_json(error const & err) -> std::string {
         std::string result;
-        result += '{';
-
-        // Type
-        std::format_to(std::back_inserter(result), R"("type":"{}")", err.type_name());
-
-        // Source location
-        auto const & loc = err.location();
-        std::format_to(std::back_inserter(result),
-                       R"(,"source":{{"file":"{}","line":{}}})",
-                       escape_json_string(loc.file_name()),
-                       loc.line());
-
-        // Data
-        if (err.size() > 0) {
-            result += R"(,"data":{)";
-            bool first = true;
-            for (auto const & [key, value] : err) {
-                if (!first) {
-                    result += ',';
-                }
-                first = false;
-                std::format_to(std::back_inserter(result),
-                               R"("{}":{})",
-                               escape_json_string(key),
-                               value_to_json(value));
-            }
-            result += '}';
+        format_sink sink(result);
+        write_object(sink, err);
+        sink.flush();
+        return result;
+    }
+
+    auto to_string_to(std::span<char> buffer, error const & err) -> std::size_t {
+        format_sink sink(buffer);
+        detail::write_string(sink, err);
+        sink.flush();
+        return sink.written();
+    }
+
+    auto to_json_to(std::span<char> buffer, error const & err) -> std::size_t {
+        format_sink sink(buffer);
+        write_object(sink, err);
+        sink.flush();
+        return sink.written();
+    }
+
+    auto error_from_json(std::string_view json) -> std::expected<error, error> {
+        auto record = parse_json_record(json);
+        if (!record) {
+            return std::unexpected(error("json_error")
+                                       .message("{} at offset {}",
+                                                record.error().reason,
+                                                record.error().offset)
+                                       .with("offset", record.error().offset));
+        }
+        return error(record->type_name, source_info {}, std::move(record->data));
+    }
+
+    auto detail::write_binary(format_sink & sink, error const & err, key_dictionary const * dict)
+        -> void {
+        write_binary_record(sink, err.type_name(), err.location(), err.data(), dict);
+    }
+
+    auto to_binary(error const & err, key_dictionary const * dict) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        detail::write_binary(sink, err, dict);
+        sink.flush();
+        return result;
+    }
+
+    auto to_binary_to(std::span<char> buffer, error const & err, key_dictionary const * dict)
+        -> std::size_t {
+        format_sink sink(buffer);
+        detail::write_binary(sink, err, dict);
+        sink.flush();
+        return sink.written();
+    }
+
+    auto error_from_binary(std::string_view bytes, key_dictionary const * dict)
+        -> std::expected<error, error> {
+        auto record = parse_binary_record(bytes, dict);
+        if (!record) {
+            return std::unexpected(error("binary_error")
+                                       .message("{} at offset {}",
+                                                record.error().reason,
+                                                record.error().offset)
+                                       .with("offset", record.error().offset));
         }
+        return error(record->type_name, source_info {}, std::move(record->data));
+    }
 
-        result += '}';
+    auto to_json(error_batch const & batch) -> std::string {
+        std::string result;
+        format_sink sink(result);
+        for (std::size_t row = 0; row < batch.size(); ++row) {
+            write_object(sink, batch[row]);
+            sink.put('\n');
+        }
+        sink.flush();
         return result;
     }
 
@@ -0,0 +1,68 @@
+//
+// hinder::queue
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/eventfd_notifier.h>
+
+#if defined(__linux__)
+
+    #include <hinder/exception/exception.h>
+    #include <hinder/queue.h>
+
+    #include <cerrno>
+    #include <cstdint>
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+
+namespace hinder {
+
+    eventfd_notifier::eventfd_notifier()
+    : m_fd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+        if (m_fd < 0) {
+            HINDER_THROW(queue_error).message("eventfd() failed").with("errno", errno);
+        }
+    }
+
+    eventfd_notifier::~eventfd_notifier() { ::close(m_fd); }
+
+    auto eventfd_notifier::notify() noexcept -> void {
+        if (!m_signalled.exchange(true)) {
+            std::uint64_t const one = 1;
+            // Cannot fail: the counter is at most 1, far below the overflow limit.
+            [[maybe_unused]] auto const written = ::write(m_fd, &one, sizeof(one));
+        }
+    }
+
+    auto eventfd_notifier::reset() noexcept -> void {
+        // Read first, then re-arm: a push() between the two finds m_signalled still set and skips
+        // the write, but its item is already in the queue and will be drained by the caller.
+        std::uint64_t count = 0;
+        [[maybe_unused]] auto const got = ::read(m_fd, &count, sizeof(count));  // EAGAIN if idle
+        m_signalled.store(false);
+    }
+
+}  // namespace hinder
+
+#endif  // __linux__
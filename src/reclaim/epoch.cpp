@@ -0,0 +1,150 @@
+//
+// hinder::reclaim
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/platform.h>
+#include <hinder/reclaim/epoch.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace hinder {
+
+    namespace detail {
+
+        // Per-guard state. Records are linked into the domain once and never unlinked until the
+        // domain is destroyed, so try_advance() may walk the list without further synchronization.
+        struct alignas(cache_line_size) epoch_record {
+            std::atomic<std::uint64_t> announced {0};        // pinned epoch; 0 when unpinned
+            std::atomic<bool>          in_use {false};
+            epoch_record *             next {nullptr};       // immutable once published
+            std::vector<retired_ptr>   retired;              // owner only
+            std::size_t                reclaim_at {0};       // owner only: retired.size() trigger
+            std::uint64_t              reclaimed_epoch {0};  // owner only: epoch at last reclaim
+        };
+
+    }  // namespace detail
+
+    epoch_domain::epoch_domain(std::size_t reclaim_threshold)
+    : m_reclaim_threshold(std::max<std::size_t>(reclaim_threshold, 1)) {}
+
+    epoch_domain::~epoch_domain() {
+        auto * record = m_head.load(std::memory_order_acquire);
+        while (record != nullptr) {
+            for (auto const & node : record->retired) {
+                node.reclaim();
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): records are owned by the domain
+            delete std::exchange(record, record->next);
+        }
+    }
+
+    auto epoch_domain::pending() const noexcept -> std::size_t {
+        return m_pending.load(std::memory_order_relaxed);
+    }
+
+    auto epoch_domain::epoch() const noexcept -> std::uint64_t { return m_epoch.load(); }
+
+    auto epoch_domain::acquire_record() -> detail::epoch_record * {
+        for (auto * record = m_head.load(std::memory_order_acquire); record != nullptr;
+             record        = record->next) {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed)
+                && record->in_use.compare_exchange_strong(expected, true,
+                                                          std::memory_order_acquire)) {
+                return record;
+            }
+        }
+
+        // All records busy: publish a new one.
+        auto * record = new detail::epoch_record;  // NOLINT(cppcoreguidelines-owning-memory)
+        record->in_use.store(true, std::memory_order_relaxed);
+        record->reclaim_at = m_reclaim_threshold;
+        auto * head        = m_head.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!m_head.compare_exchange_weak(head, record, std::memory_order_release,
+                                               std::memory_order_relaxed));
+        return record;
+    }
+
+    auto epoch_domain::try_advance() -> std::uint64_t {
+        auto current = m_epoch.load();
+        for (auto * record = m_head.load(std::memory_order_acquire); record != nullptr;
+             record        = record->next) {
+            auto const announced = record->announced.load();
+            if (announced != 0 && announced != current) {
+                return current;  // a guard has not yet observed the current epoch
+            }
+        }
+        m_epoch.compare_exchange_strong(current, current + 1);
+        return m_epoch.load();
+    }
+
+    auto epoch_domain::reclaim(detail::epoch_record & record) -> void {
+        auto const current  = try_advance();
+        bool const advanced = current != std::exchange(record.reclaimed_epoch, current);
+        auto const freed   = std::ranges::remove_if(record.retired, [current](auto const & node) {
+            if (node.epoch + 2 > current) {
+                return false;
+            }
+            node.reclaim();
+            return true;
+        });
+        m_pending.fetch_sub(freed.size(), std::memory_order_relaxed);
+        record.retired.erase(freed.begin(), freed.end());
+
+        // Back off exponentially while the epoch is held up (e.g., by a stalled guard) so each
+        // retire() stays amortized O(1) rather than rescanning an ever-growing list.
+        record.reclaim_at = advanced ? record.retired.size() + m_reclaim_threshold
+                                     : std::max(m_reclaim_threshold, 2 * record.retired.size());
+    }
+
+    epoch_domain::guard::guard(epoch_domain & domain)
+    : m_domain(domain)
+    , m_record(domain.acquire_record()) {
+        m_record->announced.store(domain.m_epoch.load());
+        // Order the announcement before any load made under the guard.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    epoch_domain::guard::~guard() {
+        m_record->announced.store(0, std::memory_order_release);
+        // Unreclaimed nodes stay with the record and are reclaimed by its next owner (or freed by
+        // the domain destructor).
+        m_record->in_use.store(false, std::memory_order_release);
+    }
+
+    auto epoch_domain::guard::retire(void * ptr, void (*deleter)(void *)) -> void {
+        auto const epoch = m_domain.m_epoch.load();
+        m_record->retired.push_back({.ptr = ptr, .deleter = deleter, .epoch = epoch});
+        m_domain.m_pending.fetch_add(1, std::memory_order_relaxed);
+        if (m_record->retired.size() >= m_record->reclaim_at) {
+            m_domain.reclaim(*m_record);
+        }
+    }
+
+}  // namespace hinder
@@ -0,0 +1,154 @@
+//
+// hinder::reclaim
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <hinder/platform.h>
+#include <hinder/reclaim/hazard_pointer.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace hinder {
+
+    namespace detail {
+
+        // Per-guard state. Records are linked into the domain once and never unlinked until the
+        // domain is destroyed, so scan() may walk the list without further synchronization.
+        struct alignas(cache_line_size) hazard_record {
+            std::array<std::atomic<void const *>, hazard_domain::slots_per_guard> hazards {};
+            std::atomic<bool>         in_use {false};
+            hazard_record *           next {nullptr};  // immutable once published
+            std::vector<retired_ptr>  retired;         // owner only
+            std::vector<void const *> protected_ptrs;  // owner only: scan() scratch
+        };
+
+    }  // namespace detail
+
+    hazard_domain::hazard_domain(std::size_t scan_threshold)
+    : m_scan_threshold(scan_threshold) {}
+
+    hazard_domain::~hazard_domain() {
+        auto * record = m_head.load(std::memory_order_acquire);
+        while (record != nullptr) {
+            for (auto const & node : record->retired) {
+                node.reclaim();
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): records are owned by the domain
+            delete std::exchange(record, record->next);
+        }
+    }
+
+    auto hazard_domain::pending() const noexcept -> std::size_t {
+        return m_pending.load(std::memory_order_relaxed);
+    }
+
+    auto hazard_domain::acquire_record() -> detail::hazard_record * {
+        for (auto * record = m_head.load(std::memory_order_acquire); record != nullptr;
+             record        = record->next) {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed)
+                && record->in_use.compare_exchange_strong(expected, true,
+                                                          std::memory_order_acquire)) {
+                return record;
+            }
+        }
+
+        // All records busy: publish a new one.
+        auto * record = new detail::hazard_record;  // NOLINT(cppcoreguidelines-owning-memory)
+        record->in_use.store(true, std::memory_order_relaxed);
+        auto * head = m_head.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!m_head.compare_exchange_weak(head, record, std::memory_order_release,
+                                               std::memory_order_relaxed));
+        m_records.fetch_add(1);
+        return record;
+    }
+
+    auto hazard_domain::scan(detail::hazard_record & record) -> void {
+        // Pairs with the seq_cst store in publish() and the seq_cst re-read in protect(): a reader
+        // either published its hazard before this snapshot, or re-reads the source after the node
+        // was unlinked and never sees it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto & hazards = record.protected_ptrs;
+        hazards.clear();
+        for (auto * other = m_head.load(std::memory_order_acquire); other != nullptr;
+             other        = other->next) {
+            for (auto const & hazard : other->hazards) {
+                if (auto const * ptr = hazard.load(std::memory_order_acquire); ptr != nullptr) {
+                    hazards.push_back(ptr);
+                }
+            }
+        }
+        std::ranges::sort(hazards);
+
+        auto const freed = std::ranges::remove_if(record.retired, [&hazards](auto const & node) {
+            if (std::ranges::binary_search(hazards, static_cast<void const *>(node.ptr))) {
+                return false;
+            }
+            node.reclaim();
+            return true;
+        });
+        m_pending.fetch_sub(freed.size(), std::memory_order_relaxed);
+        record.retired.erase(freed.begin(), freed.end());
+    }
+
+    hazard_domain::guard::guard(hazard_domain & domain)
+    : m_domain(domain)
+    , m_record(domain.acquire_record()) {}
+
+    hazard_domain::guard::~guard() {
+        for (auto & hazard : m_record->hazards) {
+            hazard.store(nullptr, std::memory_order_release);
+        }
+        // Unreclaimed nodes stay with the record and are scanned by its next owner (or freed by
+        // the domain destructor).
+        m_record->in_use.store(false, std::memory_order_release);
+    }
+
+    auto hazard_domain::guard::publish(std::size_t slot, void const * ptr) noexcept -> void {
+        m_record->hazards[slot].store(ptr, std::memory_order_seq_cst);
+    }
+
+    auto hazard_domain::guard::reset(std::size_t slot) -> void {
+        HINDER_EXPECTS(slot < slots_per_guard, reclaim_error);
+        m_record->hazards[slot].store(nullptr, std::memory_order_release);
+    }
+
+    auto hazard_domain::guard::retire(void * ptr, void (*deleter)(void *)) -> void {
+        m_record->retired.push_back({.ptr = ptr, .deleter = deleter});
+        m_domain.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+        // At least twice the total number of hazards, so every scan frees at least half the list.
+        auto const total_hazards = slots_per_guard * m_domain.m_records.load();
+        if (m_record->retired.size() >= std::max(m_domain.m_scan_threshold, 2 * total_hazards)) {
+            m_domain.scan(*m_record);
+        }
+    }
+
+}  // namespace hinder
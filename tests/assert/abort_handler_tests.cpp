@@ -0,0 +1,70 @@
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Select the handler for this translation unit only.
+#define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_ABORT
+
+#include <gtest/gtest.h>
+#include <hinder/assert/contract.h>
+
+namespace hinder_test {
+
+    // Defined in no_exceptions.cpp, which is compiled with -fno-exceptions.
+    auto default_contract_handler() -> int;
+    auto checked_ratio(int num, int den) -> int;
+
+}  // namespace hinder_test
+
+namespace {
+
+    auto checked_index(int index) -> int {
+        HINDER_EXPECTS(index >= 0, index_error);
+        return index;
+    }
+
+}  // namespace
+
+TEST(AbortHandler, PassingCheckContinues) { EXPECT_EQ(checked_index(3), 3); }
+
+TEST(AbortHandler, FailedCheckLogsAndAborts) {
+    EXPECT_DEATH(checked_index(-1),
+                 "hinder: precondition failed: index >= 0 \\[index_error\\]");
+}
+
+#ifndef NDEBUG
+TEST(AbortHandler, FailedAssertLogsTheMessage) {
+    int const count = 7;
+    EXPECT_DEATH(HINDER_ASSERT(count < 5, "count={}", count),
+                 "assertion failed: count < 5 \\[assertion_error\\]: count=7");
+}
+#endif  // !NDEBUG
+
+TEST(AbortHandler, IsTheDefaultWithoutExceptions) {
+    EXPECT_EQ(hinder_test::default_contract_handler(), HINDER_CONTRACT_HANDLER_ABORT);
+    EXPECT_EQ(hinder_test::checked_ratio(6, 3), 2);
+    EXPECT_DEATH(hinder_test::checked_ratio(1, 0), "den != 0 \\[hinder::generic_error\\]");
+}
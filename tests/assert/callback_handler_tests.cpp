@@ -0,0 +1,109 @@
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Select the handler and level for this translation unit only.
+#define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_CALLBACK
+#define HINDER_CONTRACT_LEVEL   HINDER_CONTRACT_LEVEL_AUDIT
+
+#include <gtest/gtest.h>
+#include <hinder/assert/contract.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct recorded {
+        std::string condition;
+        std::string check_type;
+        std::string exception_type;
+        std::string message;
+    };
+
+    // Callbacks are plain function pointers, so they record into a global.
+    auto records() -> std::vector<recorded> & {
+        static std::vector<recorded> all;
+        return all;
+    }
+
+    auto record(hinder::contract_violation const & violation) -> void {
+        records().push_back({violation.site.condition, violation.site.check_type,
+                             std::string(violation.exception_type),
+                             std::string(violation.message)});
+    }
+
+    class CallbackHandler : public testing::Test {
+    protected:
+        void SetUp() override {
+            records().clear();
+            m_previous = hinder::set_contract_callback(record);
+        }
+        void TearDown() override { hinder::set_contract_callback(m_previous); }
+
+    private:
+        hinder::contract_callback m_previous {nullptr};
+    };
+
+}  // namespace
+
+TEST_F(CallbackHandler, ReceivesTheViolation) {
+    HINDER_EXPECTS(1 + 1 == 3, math_error);
+    ASSERT_EQ(records().size(), 1U);
+    EXPECT_EQ(records()[0].condition, "1 + 1 == 3");
+    EXPECT_EQ(records()[0].check_type, "precondition");
+    EXPECT_EQ(records()[0].exception_type, "math_error");
+    EXPECT_EQ(records()[0].message, "");
+}
+
+TEST_F(CallbackHandler, AuditChecksRunAtTheAuditLevel) {
+    HINDER_EXPECTS_AUDIT(false, sort_error);
+    HINDER_ENSURES_AUDIT(false, sort_error);
+    HINDER_INVARIANT_AUDIT(true, sort_error);
+    ASSERT_EQ(records().size(), 2U);
+    EXPECT_EQ(records()[0].check_type, "precondition");
+    EXPECT_EQ(records()[1].check_type, "postcondition");
+}
+
+#ifndef NDEBUG
+TEST_F(CallbackHandler, ReceivesTheAssertMessage) {
+    HINDER_ASSERT(false, "expected {}, got {}", 1, 2);
+    ASSERT_EQ(records().size(), 1U);
+    EXPECT_EQ(records()[0].check_type, "assertion");
+    EXPECT_EQ(records()[0].exception_type, "assertion_error");
+    EXPECT_EQ(records()[0].message, "expected 1, got 2");
+}
+#endif  // !NDEBUG
+
+TEST_F(CallbackHandler, SetReturnsThePreviousCallback) {
+    EXPECT_EQ(hinder::set_contract_callback(nullptr), &record);
+    EXPECT_EQ(hinder::get_contract_callback(), nullptr);
+    EXPECT_EQ(hinder::set_contract_callback(record), nullptr);
+}
+
+TEST_F(CallbackHandler, AbortsWithoutACallback) {
+    hinder::set_contract_callback(nullptr);
+    EXPECT_DEATH(HINDER_INVARIANT(false, state_error), "invariant failed: false \\[state_error\\]");
+}
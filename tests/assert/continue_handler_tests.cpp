@@ -0,0 +1,76 @@
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Select the handler for this translation unit only.
+#define HINDER_CONTRACT_HANDLER HINDER_CONTRACT_HANDLER_CONTINUE
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <hinder/assert/contract.h>
+#include <string>
+
+using ::testing::HasSubstr;
+
+namespace {
+
+    auto clamped(int value) -> int {
+        HINDER_EXPECTS(value <= 10, range_error);
+        return value > 10 ? 10 : value;
+    }
+
+}  // namespace
+
+TEST(ContinueHandler, FailedCheckLogsAndContinues) {
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(clamped(42), 10);
+    auto const log = testing::internal::GetCapturedStderr();
+    EXPECT_THAT(log, HasSubstr("hinder: precondition failed: value <= 10 [range_error]"));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+    EXPECT_THAT(log, HasSubstr("continue_handler_tests.cpp:"));
+#endif
+}
+
+TEST(ContinueHandler, PassingCheckLogsNothing) {
+    testing::internal::CaptureStderr();
+    EXPECT_EQ(clamped(3), 3);
+    EXPECT_EQ(testing::internal::GetCapturedStderr(), "");
+}
+
+TEST(ContinueHandler, LogsEveryCheckType) {
+    testing::internal::CaptureStderr();
+    HINDER_ENSURES(false, state_error);
+    HINDER_INVARIANT(false, state_error);
+    auto const log = testing::internal::GetCapturedStderr();
+    EXPECT_THAT(log, HasSubstr("postcondition failed: false [state_error]"));
+    EXPECT_THAT(log, HasSubstr("invariant failed: false [state_error]"));
+}
+
+TEST(ContinueHandler, AuditChecksAreOffAtTheDefaultLevel) {
+    int evaluated = 0;
+    HINDER_EXPECTS_AUDIT(++evaluated > 100, range_error);
+    EXPECT_EQ(evaluated, 0);
+}
@@ -0,0 +1,48 @@
+//
+// hinder::assert
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Turn every check off for this translation unit only.
+#define HINDER_CONTRACT_LEVEL HINDER_CONTRACT_LEVEL_OFF
+
+#include <gtest/gtest.h>
+#include <hinder/exception/exception.h>
+
+using namespace hinder;
+
+TEST(ContractLevelOff, ConditionsAreNotEvaluated) {
+    int evaluated = 0;
+    EXPECT_NO_THROW(HINDER_EXPECTS(++evaluated < 0, generic_error));
+    EXPECT_NO_THROW(HINDER_ENSURES(++evaluated < 0, generic_error));
+    EXPECT_NO_THROW(HINDER_INVARIANT(++evaluated < 0, generic_error));
+    EXPECT_NO_THROW(HINDER_EXPECTS_AUDIT(++evaluated < 0, generic_error));
+    EXPECT_NO_THROW(HINDER_ASSERT(++evaluated < 0, "never"));
+    EXPECT_EQ(evaluated, 0);
+}
+
+TEST(ContractLevelOff, ThrowIsStillTheDefaultHandler) {
+    EXPECT_EQ(HINDER_CONTRACT_HANDLER, HINDER_CONTRACT_HANDLER_THROW);
+}
@@ -0,0 +1,193 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <hinder/exception/binary.h>
+#include <hinder/exception/exception.h>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace hinder;
+
+namespace {
+
+    auto value_of(error_record const & record, std::string_view key) -> exception_value {
+        auto const iter = record.data.find(key);
+        return iter == record.data.end() ? exception_value {} : iter->second;
+    }
+
+    auto rejection(std::string_view bytes, key_dictionary const * dict = nullptr)
+        -> std::string_view {
+        auto const record = parse_binary_record(bytes, dict);
+        return record ? std::string_view("accepted") : record.error().reason;
+    }
+
+    auto sample() -> generic_error {
+        return std::move(generic_error()
+                             .message("failed to open file")
+                             .with("errno", -2)
+                             .with("size", std::numeric_limits<std::uint64_t>::max())
+                             .with("offset", std::numeric_limits<std::int64_t>::min())
+                             .with("ratio", -0.25)
+                             .with("retry", false)
+                             .with("cached", true)
+                             .with("verbose"));
+    }
+
+    key_dictionary const keys {"message", "errno", "size", "offset", "ratio", "retry"};
+
+}  // namespace
+
+// ============================================================================
+// Round trip
+// ============================================================================
+
+TEST(BinaryRecord, RoundTripsEveryValueType) {
+    auto const exc    = sample();
+    auto const record = parse_binary_record(to_binary(exc));
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+
+    EXPECT_EQ(std::string_view(record->type_name), exc.type_name());
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+    EXPECT_EQ(std::string_view(record->file), exc.location().file_name());
+    EXPECT_EQ(record->line, exc.location().line());
+#else
+    EXPECT_EQ(std::string_view(record->file), "");
+#endif
+    // Unlike JSON, every value keeps its exact type.
+    EXPECT_EQ(record->data.size(), exc.size());
+    for (auto const & [key, value] : exc) {
+        EXPECT_EQ(value_of(*record, key.view()), value) << key.view();
+    }
+    EXPECT_TRUE(record->data.contains("verbose"));
+}
+
+TEST(BinaryRecord, RoundTripsWithDictionary) {
+    auto const exc    = sample();
+    auto const record = parse_binary_record(to_binary(exc, &keys), &keys);
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(record->data.size(), exc.size());
+    for (auto const & [key, value] : exc) {
+        EXPECT_EQ(value_of(*record, key.view()), value) << key.view();
+    }
+}
+
+TEST(BinaryRecord, DictionaryShrinksRecord) {
+    auto const exc = sample();
+    EXPECT_LT(to_binary(exc, &keys).size(), to_binary(exc).size());
+}
+
+TEST(BinaryRecord, SmallerThanJson) {
+    auto const exc = sample();
+    EXPECT_LT(to_binary(exc).size(), to_json(exc).size());
+}
+
+TEST(BinaryRecord, RoundTripsRuntimeKeysAndBinaryStrings) {
+    std::string const text("nul \0 and \xff" " bytes", 17);
+    auto const        exc    = generic_error().with(std::string("runtime key"), text);
+    auto const        record = parse_binary_record(to_binary(exc, &keys), &keys);
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(value_of(*record, "runtime key"), exception_value {text});
+}
+
+TEST(BinaryRecord, OwnsNames) {
+    auto       bytes  = to_binary(generic_error());
+    auto const record = parse_binary_record(bytes);
+    bytes.assign(bytes.size(), 'x');
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(record->type_name, "generic_error");
+}
+
+// ============================================================================
+// Streaming
+// ============================================================================
+
+TEST(BinaryRecord, ToBinaryToIteratorMatchesToBinary) {
+    auto const        exc = sample();
+    std::vector<char> out;
+    to_binary_to(std::back_inserter(out), exc, &keys);
+    EXPECT_EQ(std::string(out.begin(), out.end()), to_binary(exc, &keys));
+}
+
+TEST(BinaryRecord, ToBinaryToSpanTruncates) {
+    auto const exc   = sample();
+    auto const bytes = to_binary(exc);
+
+    std::array<char, 8> buffer {};
+    EXPECT_EQ(to_binary_to(std::span<char>(buffer), exc), bytes.size());
+    EXPECT_EQ(std::string_view(buffer.data(), buffer.size()), bytes.substr(0, buffer.size()));
+}
+
+// ============================================================================
+// Rejected input
+// ============================================================================
+
+TEST(BinaryRecord, RejectsEveryTruncation) {
+    auto const bytes = to_binary(sample());
+    for (std::size_t size = 0; size < bytes.size(); ++size) {
+        EXPECT_EQ(rejection(std::string_view(bytes).substr(0, size)), "truncated record")
+            << size;
+    }
+}
+
+TEST(BinaryRecord, RejectsTrailingBytes) {
+    EXPECT_EQ(rejection(to_binary(sample()) + '\0'), "unexpected bytes after the record");
+}
+
+TEST(BinaryRecord, RejectsUnknownVersion) {
+    auto bytes = to_binary(sample());
+    bytes[0]   = 2;
+    EXPECT_EQ(rejection(bytes), "unsupported version");
+}
+
+TEST(BinaryRecord, RejectsBadTagAndReportsOffset) {
+    // version, flags, type "t", one entry: inline key "k", tag 7
+    std::string const bytes("\x01\x00\x01t\x01\x02k\x07", 8);
+    auto const        record = parse_binary_record(bytes);
+    ASSERT_FALSE(record.has_value());
+    EXPECT_EQ(std::string_view(record.error().reason), "invalid value tag");
+    EXPECT_EQ(record.error().offset, 7U);
+}
+
+TEST(BinaryRecord, RejectsOverlongVarint) {
+    std::string const bytes("\x01\x00\xff\xff\xff\xff\xff\xff\xff\xff\xff\x7f", 12);
+    EXPECT_EQ(rejection(bytes), "varint too long");
+}
+
+TEST(BinaryRecord, RejectsDictionaryKeyWithoutDictionary) {
+    auto const bytes = to_binary(sample(), &keys);
+    EXPECT_EQ(rejection(bytes), "key not in dictionary");
+
+    key_dictionary const shorter {"message"};
+    EXPECT_EQ(rejection(bytes, &shorter), "key not in dictionary");
+}
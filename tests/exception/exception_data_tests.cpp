@@ -0,0 +1,379 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <format>
+#include <gtest/gtest.h>
+#include <hinder/exception/exception_data.h>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace hinder;
+
+namespace {
+
+    auto keys_of(exception_data const & data) -> std::vector<std::string> {
+        std::vector<std::string> keys;
+        for (auto const & [key, value] : data) {
+            keys.emplace_back(key.view());
+        }
+        return keys;
+    }
+
+    // Fill with count entries whose string values are too long for the small string optimization.
+    auto make_data(int count) -> exception_data {
+        exception_data data;
+        for (int idx = count - 1; idx >= 0; --idx) {
+            data.set("key" + std::to_string(100 + idx),
+                     std::string(40, static_cast<char>('a' + (idx % 26))));
+        }
+        return data;
+    }
+
+    // Deferred value that counts how often it is rendered.
+    class counting_value final : public detail::deferred_value {
+    public:
+        explicit counting_value(std::shared_ptr<std::atomic<int>> renders)
+        : m_renders(std::move(renders)) {}
+
+        [[nodiscard]] auto render() const -> exception_value override {
+            m_renders->fetch_add(1);
+            return std::string("rendered");
+        }
+
+        [[nodiscard]] auto clone() const -> std::unique_ptr<deferred_value> override {
+            return std::make_unique<counting_value>(m_renders);
+        }
+
+    private:
+        std::shared_ptr<std::atomic<int>> m_renders;
+    };
+
+    // Deferred value whose clone() throws, to fail a copy-on-write part way.
+    class unclonable_value final : public detail::deferred_value {
+    public:
+        [[nodiscard]] auto render() const -> exception_value override {
+            return std::string("rendered");
+        }
+
+        [[nodiscard]] auto clone() const -> std::unique_ptr<deferred_value> override {
+            throw std::runtime_error("clone failed");
+        }
+    };
+
+}  // namespace
+
+// ============================================================================
+// exception_key: short keys are stored inline, long keys on the heap
+// ============================================================================
+
+TEST(ExceptionKey, ShortKeyIsStoredInline) {
+    exception_key const key("condition");
+    EXPECT_TRUE(key.is_inline());
+    EXPECT_EQ(key.view(), "condition");
+}
+
+TEST(ExceptionKey, KeyIsCopied) {
+    std::string name = "dynamic_key";
+    exception_key const key(name);
+    name = "overwritten";
+    EXPECT_EQ(key.view(), "dynamic_key");
+
+    exception_key const from_view(std::string_view("view_key"));
+    EXPECT_EQ(from_view, "view_key");
+}
+
+TEST(ExceptionKey, RuntimeCharArrayIsCopied) {
+    char buffer[8] = "first";  // NOLINT(*-avoid-c-arrays)
+    char const(&runtime)[8] = buffer;  // NOLINT(*-avoid-c-arrays)
+    exception_key const key(runtime);
+    std::ranges::copy(std::string_view("second"), std::begin(buffer));
+    EXPECT_EQ(key, "first");
+}
+
+TEST(ExceptionKey, LongKeyIsStoredOnHeap) {
+    std::string const long_name(exception_key::inline_capacity + 1, 'k');
+    exception_key const key(long_name);
+    EXPECT_FALSE(key.is_inline());
+    EXPECT_EQ(key, long_name);
+}
+
+TEST(ExceptionKey, CopyAndMovePreserveContents) {
+    std::string const long_name(exception_key::inline_capacity * 2, 'k');
+    exception_key     short_key("short");
+    exception_key     long_key(long_name);
+
+    exception_key const short_copy(short_key);
+    exception_key const long_copy(long_key);
+    EXPECT_EQ(short_copy, "short");
+    EXPECT_EQ(long_copy, long_name);
+    EXPECT_NE(long_copy.view().data(), long_key.view().data());
+
+    exception_key moved(std::move(long_key));
+    EXPECT_EQ(moved, long_name);
+    moved = short_key;
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ(moved, "short");
+    moved = exception_key(long_name);
+    EXPECT_EQ(moved, long_name);
+}
+
+TEST(ExceptionKey, Formats) {
+    exception_key const key("path");
+    EXPECT_EQ(std::format("{}", key), "path");
+    EXPECT_EQ(std::format("[{:>6}]", key), "[  path]");
+}
+
+// ============================================================================
+// exception_data: flat small-buffer key-value storage
+// ============================================================================
+
+TEST(ExceptionData, StartsEmpty) {
+    exception_data data;
+    EXPECT_TRUE(data.empty());
+    EXPECT_EQ(data.size(), 0U);
+    EXPECT_EQ(data.begin(), data.end());
+    EXPECT_EQ(data.find("missing"), data.end());
+}
+
+TEST(ExceptionData, IteratesInKeyOrder) {
+    exception_data data;
+    data.set("path", "/tmp");
+    data.set("check_type", "precondition");
+    data.set("message", "failed");
+    data.set("condition", "x > 0");
+    EXPECT_EQ(keys_of(data),
+              (std::vector<std::string> {"check_type", "condition", "message", "path"}));
+}
+
+TEST(ExceptionData, SetOverwritesExistingKey) {
+    exception_data data;
+    data.set("code", std::int64_t {1});
+    data.set("code", std::int64_t {2});
+    ASSERT_EQ(data.size(), 1U);
+    EXPECT_EQ(std::get<std::int64_t>(data.find("code")->second), 2);
+}
+
+TEST(ExceptionData, SpillsToHeapBeyondInlineCapacity) {
+    auto const count = static_cast<int>(exception_data::inline_capacity) * 3;
+    auto       data  = make_data(count);
+    ASSERT_EQ(data.size(), static_cast<std::size_t>(count));
+    for (int idx = 0; idx < count; ++idx) {
+        auto iter = data.find("key" + std::to_string(100 + idx));
+        ASSERT_NE(iter, data.end());
+        EXPECT_EQ(std::get<std::string>(iter->second),
+                  std::string(40, static_cast<char>('a' + (idx % 26))));
+    }
+    auto const keys = keys_of(data);
+    EXPECT_TRUE(std::ranges::is_sorted(keys));
+}
+
+TEST(ExceptionData, CopyAndMoveInlineAndHeap) {
+    for (int count : {3, 20}) {
+        auto const original = make_data(count);
+
+        exception_data copy(original);
+        EXPECT_EQ(keys_of(copy), keys_of(original));
+
+        exception_data assigned;
+        assigned.set("stale", true);
+        assigned = copy;
+        EXPECT_EQ(keys_of(assigned), keys_of(original));
+
+        exception_data moved(std::move(copy));
+        EXPECT_EQ(keys_of(moved), keys_of(original));
+        EXPECT_TRUE(copy.empty());  // NOLINT(bugprone-use-after-move): moved-from is empty
+
+        exception_data move_assigned = make_data(30);
+        move_assigned                = std::move(moved);
+        EXPECT_EQ(keys_of(move_assigned), keys_of(original));
+        EXPECT_EQ(std::get<std::string>(move_assigned.find("key100")->second),
+                  std::get<std::string>(original.find("key100")->second));
+    }
+}
+
+TEST(ExceptionData, DeferredValueRendersOnFirstRead) {
+    auto           renders = std::make_shared<std::atomic<int>>(0);
+    exception_data data;
+    data.set("message", std::make_unique<counting_value>(renders));
+    data.set("code", std::int64_t {7});
+
+    EXPECT_TRUE(data.contains("message"));
+    EXPECT_EQ(data.size(), 2U);
+    EXPECT_EQ(renders->load(), 0);
+
+    auto iter = data.find("message");
+    ASSERT_NE(iter, data.end());
+    EXPECT_EQ(std::get<std::string>(iter->second), "rendered");
+    (void)data.begin();
+    EXPECT_EQ(renders->load(), 1);
+}
+
+TEST(ExceptionData, CopiesShareOneRender) {
+    auto           renders = std::make_shared<std::atomic<int>>(0);
+    exception_data data;
+    data.set("message", std::make_unique<counting_value>(renders));
+
+    exception_data copy(data);
+    exception_data moved(std::move(data));
+    EXPECT_EQ(renders->load(), 0);
+
+    EXPECT_EQ(std::get<std::string>(copy.find("message")->second), "rendered");
+    EXPECT_EQ(std::get<std::string>(moved.find("message")->second), "rendered");
+    EXPECT_EQ(renders->load(), 1);
+}
+
+TEST(ExceptionData, CopySharesUntilWritten) {
+    auto const     original = make_data(3);
+    exception_data copy(original);
+    EXPECT_TRUE(copy.shares_with(original));
+    EXPECT_EQ(copy.begin(), original.begin());
+
+    copy.set("extra", true);
+    EXPECT_FALSE(copy.shares_with(original));
+    EXPECT_EQ(copy.size(), original.size() + 1);
+    EXPECT_FALSE(original.contains("extra"));
+}
+
+TEST(ExceptionData, CopyBeforeRenderThenWriteRendersIndependently) {
+    auto           renders = std::make_shared<std::atomic<int>>(0);
+    exception_data data;
+    data.set("message", std::make_unique<counting_value>(renders));
+
+    exception_data copy(data);
+    copy.set("code", std::int64_t {1});
+    EXPECT_EQ(renders->load(), 0);
+    EXPECT_EQ(std::get<std::string>(copy.find("message")->second), "rendered");
+    EXPECT_EQ(std::get<std::string>(data.find("message")->second), "rendered");
+    EXPECT_EQ(renders->load(), 2);
+}
+
+TEST(ExceptionData, FailedCopyOnWriteLeavesBothHandlesIntact) {
+    // Heap entries, so that a leak of the copied entries or their array shows under a sanitizer.
+    exception_data data = make_data(20);
+    data.set("message", std::make_unique<unclonable_value>());
+
+    exception_data copy(data);
+    EXPECT_THROW(copy.set("extra", true), std::runtime_error);
+    EXPECT_TRUE(copy.shares_with(data));
+    EXPECT_FALSE(copy.contains("extra"));
+    EXPECT_EQ(std::get<std::string>(data.find("message")->second), "rendered");
+}
+
+TEST(ExceptionData, ConcurrentCopiesAndReads) {
+    exception_data data = make_data(20);
+
+    std::vector<std::thread> workers;
+    for (int idx = 0; idx < 8; ++idx) {
+        workers.emplace_back([&data, idx]() -> void {
+            for (int round = 0; round < 1000; ++round) {
+                exception_data copy(data);
+                if (round % 2 == 0) {
+                    copy.set("worker", std::int64_t {idx});
+                }
+                EXPECT_EQ(copy.size(), data.size() + static_cast<std::size_t>(round % 2 == 0));
+            }
+        });
+    }
+    for (auto & worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(data.size(), 20U);
+}
+
+TEST(ExceptionData, EagerValueReplacesDeferred) {
+    auto           renders = std::make_shared<std::atomic<int>>(0);
+    exception_data data;
+    data.set("message", std::make_unique<counting_value>(renders));
+    data.set("message", "eager");
+    EXPECT_EQ(std::get<std::string>(data.find("message")->second), "eager");
+    EXPECT_EQ(renders->load(), 0);
+}
+
+TEST(ExceptionData, ConcurrentReadersRenderOnce) {
+    auto           renders = std::make_shared<std::atomic<int>>(0);
+    exception_data data;
+    data.set("message", std::make_unique<counting_value>(renders));
+
+    std::vector<std::thread> readers;
+    for (int idx = 0; idx < 8; ++idx) {
+        readers.emplace_back([&data]() -> void {
+            EXPECT_EQ(std::get<std::string>(data.find("message")->second), "rendered");
+        });
+    }
+    for (auto & reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(renders->load(), 1);
+}
+
+namespace {
+
+    constexpr throw_site test_site {"ptr != nullptr", "precondition"};
+
+}  // namespace
+
+TEST(ExceptionData, SiteEntriesMaterializeOnFirstRead) {
+    exception_data data;
+    data.set(test_site);
+    data.set("code", std::int64_t {7});
+
+    EXPECT_TRUE(data.contains("condition"));
+    EXPECT_TRUE(data.contains("check_type"));
+    EXPECT_EQ(data.size(), 3U);
+    EXPECT_EQ(std::get<std::string>(data.find("condition")->second), "ptr != nullptr");
+    EXPECT_EQ(std::get<std::string>(data.find("check_type")->second), "precondition");
+}
+
+TEST(ExceptionData, CopyBeforeReadSharesSite) {
+    auto           renders = std::make_shared<std::atomic<int>>(0);
+    exception_data data;
+    data.set("message", std::make_unique<counting_value>(renders));
+    data.set(test_site);
+
+    exception_data copy(data);
+    exception_data moved(std::move(data));
+    EXPECT_EQ(renders->load(), 0);
+    EXPECT_EQ(std::get<std::string>(copy.find("condition")->second), "ptr != nullptr");
+    EXPECT_EQ(std::get<std::string>(moved.find("check_type")->second), "precondition");
+    EXPECT_EQ(std::get<std::string>(moved.find("message")->second), "rendered");
+}
+
+TEST(ExceptionData, EagerValueReplacesSiteEntry) {
+    exception_data data;
+    data.set(test_site);
+    data.set("condition", "overridden");
+    EXPECT_EQ(std::get<std::string>(data.find("condition")->second), "overridden");
+    EXPECT_EQ(std::get<std::string>(data.find("check_type")->second), "precondition");
+}
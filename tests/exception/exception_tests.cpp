@@ -24,14 +24,24 @@
 // SOFTWARE.
 //
 
+#include <array>
 #include <cstdint>
+#include <exception>
+#include <format>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <hinder/exception/exception.h>
+#include <iterator>
+#include <source_location>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 using ::testing::EndsWith;
 using ::testing::HasSubstr;
+using ::testing::Not;
 using ::testing::StartsWith;
 using namespace hinder;
 
@@ -155,6 +165,8 @@ TEST(Exception, FlagstyleKeyWithNoValue) {
     FAIL() << "Expected exception to be thrown";
 }
 
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+
 TEST(Exception, SourceLocationIsCaptured) {
     try {
         throw generic_error().message("test");
@@ -167,6 +179,34 @@ TEST(Exception, SourceLocationIsCaptured) {
     FAIL() << "Expected exception to be thrown";
 }
 
+TEST(Exception, SourceFileNameIsRelativeToSourceRoot) {
+    try {
+        throw generic_error();
+    } catch (generic_error const & e) {
+        EXPECT_STREQ(e.location().file_name(), "tests/exception/exception_tests.cpp");
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+#else
+
+TEST(Exception, SourceIsOmittedWhenDisabled) {
+    static_assert(std::is_empty_v<source_info>);
+    try {
+        throw generic_error().message("test");
+    } catch (generic_error const & e) {
+        EXPECT_STREQ(e.location().file_name(), "");
+        EXPECT_EQ(e.location().line(), 0U);
+        EXPECT_THAT(to_string(e), Not(HasSubstr("@")));
+        EXPECT_THAT(to_json(e), Not(HasSubstr("\"source\"")));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
+
 // ============================================================================
 // Data retrieval
 // ============================================================================
@@ -187,6 +227,33 @@ TEST(Exception, GettingValuesThatExist) {
     FAIL() << "Expected exception to be thrown";
 }
 
+TEST(Exception, NonCopyingAccessors) {
+    try {
+        throw generic_error().with("count", 42).with("name", "a name too long for inline storage");
+    } catch (generic_error const & e) {
+        auto const * name = e.get_ref("name");
+        ASSERT_NE(name, nullptr);
+        EXPECT_EQ(name, e.get_ref("name"));
+        EXPECT_EQ(e.get_ref("missing"), nullptr);
+
+        auto view = e.get_as<std::string_view>("name");
+        ASSERT_TRUE(view.has_value());
+        EXPECT_EQ(view->data(), std::get<std::string>(*name).data());
+        EXPECT_FALSE(e.get_as<std::string_view>("count").has_value());
+
+        std::int64_t seen = 0;
+        EXPECT_TRUE(e.visit("count", [&seen](auto const & val) -> void {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(val)>, std::int64_t>) {
+                seen = val;
+            }
+        }));
+        EXPECT_EQ(seen, 42);
+        EXPECT_FALSE(e.visit("missing", [](auto const &) -> void {}));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
 TEST(Exception, GettingMissingKeys) {
     try {
         throw generic_error();
@@ -216,6 +283,58 @@ TEST(Exception, IteratingOverKeyvaluePairs) {
     FAIL() << "Expected exception to be thrown";
 }
 
+TEST(Exception, ShortKeysAreStoredInline) {
+    std::string const runtime_key = "runtime";
+    try {
+        throw generic_error().message("failed").with("path", "/tmp").with(runtime_key, 1);
+    } catch (generic_error const & e) {
+        for (auto const & [key, value] : e) {
+            (void)value;
+            EXPECT_TRUE(key.is_inline()) << key.view();
+        }
+        EXPECT_EQ(e.get_as<int>("runtime"), 1);
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, DeferredMessageCapturesArguments) {
+    std::string name   = "config.json";
+    char        buf[8] = "abc";
+    try {
+        throw generic_error().message("failed to open {} ({}, {})", name, buf, 42);
+    } catch (generic_error const & e) {
+        // The message is rendered on first read from copies taken at the throw site.
+        name   = "overwritten";
+        buf[0] = 'X';
+        EXPECT_EQ(e.get_as<std::string>("message"), "failed to open config.json (abc, 42)");
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, DeferredMessageInFormattedOutput) {
+    try {
+        throw generic_error().message("value={}", 3.5).with("code", 1);
+    } catch (generic_error const & e) {
+        EXPECT_THAT(to_string(e), HasSubstr("message: value=3.5"));
+        EXPECT_THAT(to_json(e), HasSubstr(R"("message":"value=3.5")"));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, LaterMessageReplacesEarlierOne) {
+    try {
+        throw generic_error().message("first {}", 1).message("second {}", 2);
+    } catch (generic_error const & e) {
+        EXPECT_EQ(e.get_as<std::string>("message"), "second 2");
+        EXPECT_EQ(e.size(), 1U);
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
 // ============================================================================
 // Formatting
 // ============================================================================
@@ -230,8 +349,10 @@ TEST(Exception, To_stringFormatting) {
         auto result = to_string(e);
 
         EXPECT_THAT(result, HasSubstr("generic_error"));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
         EXPECT_THAT(result, HasSubstr("@"));
         EXPECT_THAT(result, HasSubstr("exception_tests.cpp:"));
+#endif
         EXPECT_THAT(result, HasSubstr("message: Failed to open file"));
         EXPECT_THAT(result, HasSubstr("path: /etc/config.json"));
         EXPECT_THAT(result, HasSubstr("errno: 2"));
@@ -246,7 +367,9 @@ TEST(Exception, To_stringEmptyException) {
     } catch (exception const & e) {
         auto result = to_string(e);
         EXPECT_THAT(result, HasSubstr("generic_error"));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
         EXPECT_THAT(result, HasSubstr("@"));
+#endif
         return;
     }
     FAIL() << "Expected exception to be thrown";
@@ -261,9 +384,11 @@ TEST(Exception, To_jsonFormatting) {
         EXPECT_THAT(result, StartsWith("{"));
         EXPECT_THAT(result, EndsWith("}"));
         EXPECT_THAT(result, HasSubstr("\"type\":\"generic_error\""));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
         EXPECT_THAT(result, HasSubstr("\"source\":{"));
         EXPECT_THAT(result, HasSubstr("\"file\":"));
         EXPECT_THAT(result, HasSubstr("\"line\":"));
+#endif
         EXPECT_THAT(result, HasSubstr("\"data\":{"));
         EXPECT_THAT(result, HasSubstr("\"message\":\"Test message\""));
         EXPECT_THAT(result, HasSubstr("\"count\":42"));
@@ -303,10 +428,186 @@ TEST(Exception, JsonEscapingControlCharacters) {
     FAIL() << "Expected exception to be thrown";
 }
 
+TEST(Exception, JsonEscapingAtEveryOffset) {
+    // Lengths and positions either side of the 16- and 32-byte blocks the escaper scans.
+    for (std::size_t length = 1; length <= 80; ++length) {
+        for (std::size_t pos = 0; pos < length; ++pos) {
+            for (char const special : {'"', '\\', '\x01', '\x1f'}) {
+                std::string text(length, 'a');
+                text[pos] = special;
+
+                std::string expected = text.substr(0, pos);
+                switch (special) {
+                case '"':
+                    expected += "\\\"";
+                    break;
+                case '\\':
+                    expected += "\\\\";
+                    break;
+                default:
+                    expected += special == '\x01' ? "\\u0001" : "\\u001f";
+                }
+                expected += text.substr(pos + 1);
+
+                try {
+                    throw generic_error().with("text", text);
+                } catch (exception const & e) {
+                    ASSERT_THAT(to_json(e), HasSubstr(R"("text":")" + expected + '"'))
+                        << "length " << length << ", position " << pos;
+                }
+            }
+        }
+    }
+}
+
+TEST(Exception, JsonEscapingLeavesDelAndHighBytes) {
+    std::string text;
+    for (int idx = 0; idx < 20; ++idx) {
+        text += "\x7f\xc3\xa9";
+    }
+    try {
+        throw generic_error().with("text", text);
+    } catch (exception const & e) {
+        EXPECT_THAT(to_json(e), HasSubstr(text));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, To_json_toMatchesTo_json) {
+    try {
+        throw generic_error().message("Test message").with("count", 42).with("ratio", 0.25);
+    } catch (exception const & e) {
+        std::string json;
+        to_json_to(std::back_inserter(json), e);
+        EXPECT_EQ(json, to_json(e));
+
+        std::string text;
+        to_string_to(std::back_inserter(text), e);
+        EXPECT_EQ(text, to_string(e));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, To_json_toWritesOutputLargerThanTheSinkBuffer) {
+    try {
+        throw generic_error()
+            .with("long", std::string(format_sink::buffer_size * 3, 'x'))
+            .with("escaped", std::string(format_sink::buffer_size, '"'));
+    } catch (exception const & e) {
+        std::vector<char> json;
+        to_json_to(std::back_inserter(json), e);
+        EXPECT_EQ(std::string(json.begin(), json.end()), to_json(e));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, To_json_toSpanReturnsFullLength) {
+    try {
+        throw generic_error().message("Test message");
+    } catch (exception const & e) {
+        auto const expected = to_json(e);
+
+        std::vector<char> exact(expected.size());
+        ASSERT_EQ(to_json_to(std::span<char>(exact), e), expected.size());
+        EXPECT_EQ(std::string_view(exact.data(), exact.size()), expected);
+
+        // Truncated: the prefix is written and the full length reported.
+        std::array<char, 8> small {};
+        EXPECT_EQ(to_json_to(std::span<char>(small), e), expected.size());
+        EXPECT_EQ(std::string_view(small.data(), small.size()), expected.substr(0, small.size()));
+
+        EXPECT_EQ(to_string_to(std::span<char> {}, e), to_string(e).size());
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, FormatterMatchesTo_stringAndTo_json) {
+    try {
+        throw generic_error().message("Test message").with("count", 42);
+    } catch (exception const & e) {
+        EXPECT_EQ(std::format("{}", e), to_string(e));
+        EXPECT_EQ(std::format("{:h}", e), to_string(e));
+        EXPECT_EQ(std::format("{:j}", e), to_json(e));
+
+        std::string line = "failed: ";
+        std::format_to(std::back_inserter(line), "{:j}", e);
+        EXPECT_EQ(line, "failed: " + to_json(e));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, FormatterAcceptsDerivedTypes) {
+    try {
+        throw generic_error().with("count", 1);
+    } catch (generic_error const & e) {
+        EXPECT_EQ(std::format("{:j}", e), to_json(e));
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, FormatterCompactIsOneLine) {
+    try {
+        throw generic_error()
+            .message("two\nlines")
+            .with("count", 42)
+            .with("enabled", true)
+            .with("verbose");
+    } catch (exception const & e) {
+        auto const result = std::format("{:c}", e);
+        EXPECT_THAT(result, StartsWith("generic_error"));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+        EXPECT_THAT(result, HasSubstr(" @"));
+        EXPECT_THAT(result, HasSubstr("exception_tests.cpp:"));
+#endif
+        EXPECT_THAT(result, HasSubstr(R"( message="two\nlines")"));
+        EXPECT_THAT(result, HasSubstr(" count=42"));
+        EXPECT_THAT(result, HasSubstr(" enabled=true"));
+        EXPECT_THAT(result, HasSubstr(" verbose"));
+        EXPECT_EQ(result.find('\n'), std::string::npos);
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, FormatterRejectsUnknownSpec) {
+    try {
+        throw generic_error();
+    } catch (exception const & e) {
+        EXPECT_THROW(static_cast<void>(std::vformat("{:x}", std::make_format_args(e))),
+                     std::format_error);
+        EXPECT_THROW(static_cast<void>(std::vformat("{:jj}", std::make_format_args(e))),
+                     std::format_error);
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(Exception, FormattedValue) {
+    exception_value const text {std::string("say \"hi\"")};
+    EXPECT_EQ(std::format("{}", formatted_value {text}), "say \"hi\"");
+    EXPECT_EQ(std::format("{:j}", formatted_value {text}), R"("say \"hi\"")");
+    EXPECT_EQ(std::format("{:c}", formatted_value {text}), R"("say \"hi\"")");
+
+    exception_value const number {std::int64_t {-42}};
+    EXPECT_EQ(std::format("{}/{:j}", formatted_value {number}, formatted_value {number}),
+              "-42/-42");
+
+    exception_value const flag {};
+    EXPECT_EQ(std::format("[{}]", formatted_value {flag}), "[]");
+    EXPECT_EQ(std::format("{:j}", formatted_value {flag}), "null");
+}
+
 // ============================================================================
 // Macros
 // ============================================================================
 
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
 TEST(Exception, Hinder_throwCapturesSourceLocation) {
     try {
         HINDER_THROW(generic_error).message("test");
@@ -317,6 +618,7 @@ TEST(Exception, Hinder_throwCapturesSourceLocation) {
     }
     FAIL() << "Expected exception to be thrown";
 }
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
 
 TEST(Exception, Hinder_throwTypeHierarchy) {
     EXPECT_THROW(HINDER_THROW(generic_error), generic_error);
@@ -368,6 +670,51 @@ TEST(Exception, Hinder_invariantPassesOnTrue) {
     EXPECT_NO_THROW(HINDER_INVARIANT(true, generic_error));
 }
 
+TEST(Exception, TypeNameIsStaticPerType) {
+    EXPECT_EQ(generic_error::static_type_name, "generic_error");
+    generic_error first;
+    generic_error second;
+    EXPECT_EQ(first.type_name().data(), second.type_name().data());
+    EXPECT_STREQ(first.what(), "generic_error");
+}
+
+TEST(Exception, ContractDataSurvivesCopy) {
+    std::exception_ptr ptr;
+    try {
+        HINDER_EXPECTS(1 > 2, generic_error);
+    } catch (...) {
+        ptr = std::current_exception();
+    }
+    try {
+        std::rethrow_exception(ptr);
+    } catch (exception const & e) {
+        exception const copy(e);
+        EXPECT_EQ(copy.get_as<std::string>("condition").value_or(""), "1 > 2");
+        EXPECT_EQ(copy.get_as<std::string>("check_type").value_or(""), "precondition");
+        EXPECT_EQ(copy.size(), 2U);
+    }
+}
+
+TEST(Exception, ContractMacrosThrowTheNamedType) {
+    EXPECT_THROW(HINDER_EXPECTS(false, assertion_error), assertion_error);
+    EXPECT_THROW(HINDER_ENSURES(false, assertion_error), assertion_error);
+    EXPECT_THROW(HINDER_INVARIANT(false, assertion_error), assertion_error);
+}
+
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+TEST(Exception, ContractMacrosCaptureTheCheckSite) {
+    std::uint_least32_t line = 0;
+    try {
+        line = std::source_location::current().line() + 1;
+        HINDER_EXPECTS(line == 0, generic_error);
+        FAIL() << "Expected exception";
+    } catch (exception const & e) {
+        EXPECT_EQ(e.location().line(), line);
+        EXPECT_THAT(e.location().function_name(), HasSubstr("ContractMacrosCaptureTheCheckSite"));
+    }
+}
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
+
 // ============================================================================
 // Inheritance
 // ============================================================================
@@ -510,6 +857,7 @@ TEST(Assert, HinderassertCapturesConditionAndMessage) {
     }
 }
 
+    #if defined(HINDER_WITH_EXCEPTION_SOURCE)
 TEST(Assert, HinderassertCapturesSourceLocation) {
     try {
         HINDER_ASSERT(false, "test assertion");
@@ -520,5 +868,6 @@ TEST(Assert, HinderassertCapturesSourceLocation) {
         EXPECT_TRUE(loc.line() > 0);
     }
 }
+    #endif  // HINDER_WITH_EXCEPTION_SOURCE
 
 #endif  // !NDEBUG
@@ -0,0 +1,198 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <hinder/exception/exception.h>
+#include <hinder/exception/json_record.h>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <variant>
+
+using namespace hinder;
+
+namespace {
+
+    auto value_of(error_record const & record, std::string_view key) -> exception_value {
+        auto const iter = record.data.find(key);
+        return iter == record.data.end() ? exception_value {} : iter->second;
+    }
+
+    auto rejection(std::string_view json) -> std::string_view {
+        auto const record = parse_json_record(json);
+        return record ? std::string_view("accepted") : record.error().reason;
+    }
+
+}  // namespace
+
+// ============================================================================
+// Round trip
+// ============================================================================
+
+TEST(JsonRecord, RoundTripsAnException) {
+    try {
+        throw generic_error()
+            .message("failed to open file")
+            .with("errno", 2)
+            .with("size", std::numeric_limits<std::uint64_t>::max())
+            .with("ratio", 0.25)
+            .with("retry", false)
+            .with("verbose");
+    } catch (exception const & e) {
+        auto const record = parse_json_record(to_json(e));
+        ASSERT_TRUE(record.has_value()) << record.error().reason;
+
+        EXPECT_EQ(std::string_view(record->type_name), e.type_name());
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+        EXPECT_EQ(std::string_view(record->file), e.location().file_name());
+        EXPECT_EQ(record->line, e.location().line());
+#else
+        EXPECT_EQ(std::string_view(record->file), "");
+#endif
+        EXPECT_EQ(record->data.size(), e.size());
+        EXPECT_EQ(value_of(*record, "message"),
+                  exception_value {std::string("failed to open file")});
+        EXPECT_EQ(value_of(*record, "errno"), exception_value {std::int64_t {2}});
+        EXPECT_EQ(value_of(*record, "size"),
+                  exception_value {std::numeric_limits<std::uint64_t>::max()});
+        EXPECT_EQ(value_of(*record, "ratio"), exception_value {0.25});
+        EXPECT_EQ(value_of(*record, "retry"), exception_value {false});
+        EXPECT_TRUE(record->data.contains("verbose"));
+        EXPECT_EQ(value_of(*record, "verbose"), exception_value {});
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(JsonRecord, RoundTripsEscapedStrings) {
+    std::string const text = "say \"hi\"\\ \n\r\t \x01\x1f caf\xc3\xa9";
+    try {
+        throw generic_error().with(std::string("key \"quoted\""), text);
+    } catch (exception const & e) {
+        auto const record = parse_json_record(to_json(e));
+        ASSERT_TRUE(record.has_value()) << record.error().reason;
+        EXPECT_EQ(value_of(*record, "key \"quoted\""), exception_value {text});
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(JsonRecord, OwnsNames) {
+    auto json = std::string(R"({"type":"owned_error","source":{"file":"a.cpp","line":1}})");
+    auto const record = parse_json_record(json);
+    json.assign(json.size(), 'x');
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(record->type_name, "owned_error");
+    EXPECT_EQ(record->file, "a.cpp");
+}
+
+// ============================================================================
+// Accepted input
+// ============================================================================
+
+TEST(JsonRecord, AcceptsWhitespaceAndAnyMemberOrder) {
+    auto const record = parse_json_record(R"(
+        {
+            "data" : { "count" : -3 , "big" : 1e+20 },
+            "source" : { "line" : 42 , "file" : "src/main.cpp" },
+            "type" : "parse_error"
+        }
+    )");
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(std::string_view(record->type_name), "parse_error");
+    EXPECT_EQ(std::string_view(record->file), "src/main.cpp");
+    EXPECT_EQ(record->line, 42U);
+    EXPECT_EQ(value_of(*record, "count"), exception_value {std::int64_t {-3}});
+    EXPECT_EQ(value_of(*record, "big"), exception_value {1e20});
+}
+
+TEST(JsonRecord, SkipsContextStackAndUnknownMembers) {
+    auto const record = parse_json_record(
+        R"({"type":"io_error","context":[{"file":"a.cpp","line":1,"note":"x"}],)"
+        R"("context_dropped":3,"stack":[{"address":"0x1","symbol":"f","object":""}],)"
+        R"("extra":{"nested":[true,null,{"deep":"A"}]},"data":{"k":"v"}})");
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(std::string_view(record->type_name), "io_error");
+    EXPECT_EQ(value_of(*record, "k"), exception_value {std::string("v")});
+}
+
+TEST(JsonRecord, DecodesUnicodeEscapes) {
+    auto const record =
+        parse_json_record(R"({"type":"t","data":{"text":"caf\u00e9 \ud83d\ude00 \/"}})");
+    ASSERT_TRUE(record.has_value()) << record.error().reason;
+    EXPECT_EQ(value_of(*record, "text"),
+              exception_value {std::string("caf\xc3\xa9 \xf0\x9f\x98\x80 /")});
+}
+
+// ============================================================================
+// Rejected input
+// ============================================================================
+
+TEST(JsonRecord, RejectsMalformedInput) {
+    EXPECT_EQ(rejection(""), "unexpected character");
+    EXPECT_EQ(rejection("[]"), "unexpected character");
+    EXPECT_EQ(rejection(R"({"data":{}})"), "missing \"type\"");
+    EXPECT_EQ(rejection(R"({"type":"t")"), "expected ',' or '}'");
+    EXPECT_EQ(rejection(R"({"type":"t)"), "unterminated string");
+    EXPECT_EQ(rejection(R"({"type" "t"})"), "expected ':'");
+    EXPECT_EQ(rejection(R"({"type":"t"} x)"), "unexpected text after the object");
+    EXPECT_EQ(rejection(R"({"type":"\q"})"), "invalid escape");
+    EXPECT_EQ(rejection(R"({"type":"\ud83d"})"), "unpaired surrogate");
+    EXPECT_EQ(rejection(R"({"type":"\u12"})"), "invalid unicode escape");
+    EXPECT_EQ(rejection(R"({"type":"t","data":{"k":tru}})"), "invalid literal");
+    EXPECT_EQ(rejection(R"({"type":"t","data":{"k":1.2.3}})"), "invalid number");
+    EXPECT_EQ(rejection(R"({"type":"t","data":{"k":[1]}})"), "unexpected character");
+    EXPECT_EQ(rejection(R"({"type":"t","source":{"line":-1}})"), "invalid line number");
+}
+
+TEST(JsonRecord, RejectsEveryTruncation) {
+    try {
+        throw generic_error().message("caf\xc3\xa9 \"x\"\n").with("n", -1.5).with("flag");
+    } catch (exception const & e) {
+        auto const json = to_json(e);
+        for (std::size_t length = 0; length < json.size(); ++length) {
+            EXPECT_FALSE(parse_json_record(json.substr(0, length)).has_value()) << length;
+        }
+        EXPECT_TRUE(parse_json_record(json).has_value());
+        return;
+    }
+    FAIL() << "Expected exception to be thrown";
+}
+
+TEST(JsonRecord, RejectsDeepNesting) {
+    std::string json = R"({"type":"t","extra":)";
+    json += std::string(100, '[');
+    json += std::string(100, ']');
+    json += '}';
+    EXPECT_EQ(rejection(json), "nesting too deep");
+}
+
+TEST(JsonRecord, ReportsTheOffset) {
+    auto const record = parse_json_record(R"({"type":"t","data":{"k":?}})");
+    ASSERT_FALSE(record.has_value());
+    EXPECT_EQ(record.error().offset, 24U);
+}
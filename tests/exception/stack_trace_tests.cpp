@@ -0,0 +1,104 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <algorithm>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <hinder/exception/exception.h>
+#include <hinder/exception/stack_trace.h>
+#include <string>
+
+using ::testing::HasSubstr;
+using ::testing::Not;
+using namespace hinder;
+
+namespace {
+
+    HINDER_DEFINE_TRACED_EXCEPTION(traced_error, generic_error);
+
+    // Separate, exported frame so the trace has a known name in it.
+    [[gnu::noinline]] auto throw_traced_error() -> void {
+        throw traced_error().message("traced");
+    }
+
+    auto has_symbol(stack_trace const & trace, std::string const & name) -> bool {
+        auto const frames = trace.symbolize();
+        return std::ranges::any_of(frames, [&name](stack_trace::frame const & frame) -> bool {
+            return frame.symbol.find(name) != std::string::npos;
+        });
+    }
+
+}  // namespace
+
+// Exported (not in the anonymous namespace) so dladdr can name it.
+[[gnu::noinline]] auto hinder_stack_trace_capture_here() -> stack_trace {
+    return stack_trace::capture();
+}
+
+#if defined(__GNUC__)
+TEST(StackTrace, CaptureRecordsCallers) {
+    auto const trace = hinder_stack_trace_capture_here();
+    ASSERT_FALSE(trace.empty());
+    EXPECT_LE(trace.size(), stack_trace::max_frames);
+    EXPECT_EQ(trace.addresses().size(), trace.size());
+    EXPECT_TRUE(has_symbol(trace, "hinder_stack_trace_capture_here"));
+}
+
+TEST(StackTrace, SymbolizeResolvesObjects) {
+    auto const frames = hinder_stack_trace_capture_here().symbolize();
+    ASSERT_FALSE(frames.empty());
+    EXPECT_FALSE(frames.front().object.empty());
+    EXPECT_NE(frames.front().address, nullptr);
+}
+
+TEST(StackTrace, TracedExceptionCapturesAtThrow) {
+    try {
+        throw_traced_error();
+        FAIL() << "Expected traced_error";
+    } catch (exception const & e) {
+        ASSERT_NE(e.trace(), nullptr);
+        EXPECT_FALSE(e.trace()->empty());
+        EXPECT_THAT(to_string(e), HasSubstr("\n  stack:\n    #0 "));
+        EXPECT_THAT(to_json(e), HasSubstr(R"(,"stack":[{"address":")"));
+    }
+}
+#endif  // __GNUC__
+
+#if !defined(HINDER_WITH_STACK_TRACE)
+TEST(StackTrace, PlainExceptionsAreNotTraced) {
+    generic_error const err;
+    EXPECT_EQ(err.trace(), nullptr);
+    EXPECT_THAT(to_string(err), Not(HasSubstr("stack:")));
+    EXPECT_THAT(to_json(err), Not(HasSubstr(R"("stack")")));
+}
+#endif  // !HINDER_WITH_STACK_TRACE
+
+TEST(StackTrace, CopiesKeepTheTrace) {
+    traced_error const original;
+    traced_error const copy(original);  // NOLINT(performance-unnecessary-copy-initialization)
+    ASSERT_NE(copy.trace(), nullptr);
+    EXPECT_EQ(copy.trace()->size(), original.trace()->size());
+}
@@ -0,0 +1,184 @@
+//
+// hinder::exception
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Opt in for this translation unit only.
+#define HINDER_WITH_THROW_STATS
+
+#include <algorithm>
+#include <chrono>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <hinder/exception/exception.h>
+#include <hinder/exception/throw_stats.h>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using ::testing::HasSubstr;
+using namespace hinder;
+
+namespace {
+
+    HINDER_DEFINE_EXCEPTION(counted_error, generic_error);
+    HINDER_DEFINE_EXCEPTION(rare_error, generic_error);
+
+    auto throw_counted(int code) -> void { HINDER_THROW(counted_error).with("code", code); }
+
+    auto throw_rare() -> void { HINDER_THROW(rare_error).message("rare"); }
+
+    auto catch_counted(int code) -> counted_error {
+        try {
+            throw_counted(code);
+        } catch (counted_error const & exc) {
+            return exc;
+        }
+        return counted_error();
+    }
+
+    auto stats_for(std::string_view type_name) -> std::optional<throw_site_stats> {
+        auto const stats = collect_throw_stats();
+        auto const iter  = std::ranges::find(stats, type_name, &throw_site_stats::type_name);
+        return iter == stats.end() ? std::nullopt : std::optional(*iter);
+    }
+
+}  // namespace
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+TEST(ThrowStats, CountsEachSite) {
+    reset_throw_stats();
+    auto const before = std::chrono::system_clock::now();
+    for (int idx = 0; idx < 5; ++idx) {
+        EXPECT_THROW(throw_counted(idx), counted_error);
+    }
+    EXPECT_THROW(throw_rare(), rare_error);
+
+    auto const counted = stats_for("counted_error");
+    ASSERT_TRUE(counted.has_value());
+    EXPECT_EQ(counted->count, 5U);
+    EXPECT_GE(counted->first_seen, before);
+    EXPECT_GE(counted->last_seen, counted->first_seen);
+    EXPECT_EQ(stats_for("rare_error")->count, 1U);
+
+    // Most frequent first
+    auto const stats = collect_throw_stats();
+    ASSERT_GE(stats.size(), 2U);
+    EXPECT_TRUE(std::ranges::is_sorted(stats, std::ranges::greater {}, &throw_site_stats::count));
+}
+
+TEST(ThrowStats, ThrownExceptionIsUnchanged) {
+    auto const exc = catch_counted(7);
+    EXPECT_EQ(exc.type_name(), "counted_error");
+    EXPECT_EQ(exc.get_as<int>("code"), 7);
+}
+
+TEST(ThrowStats, ResetClearsCounts) {
+    EXPECT_THROW(throw_rare(), rare_error);
+    reset_throw_stats();
+    EXPECT_FALSE(stats_for("rare_error").has_value());
+}
+
+TEST(ThrowStats, ConcurrentThrowsAreAllCounted) {
+    reset_throw_stats();
+    std::vector<std::thread> workers;
+    for (int idx = 0; idx < 4; ++idx) {
+        workers.emplace_back([]() -> void {
+            for (int round = 0; round < 250; ++round) {
+                EXPECT_THROW(throw_counted(round), counted_error);
+            }
+        });
+    }
+    for (auto & worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(stats_for("counted_error")->count, 1000U);
+}
+
+TEST(ThrowStats, ToJson) {
+    reset_throw_stats();
+    EXPECT_THROW(throw_rare(), rare_error);
+    auto const json = to_json(collect_throw_stats());
+    EXPECT_THAT(json, HasSubstr(R"([{"type":"rare_error")"));
+    EXPECT_THAT(json, HasSubstr(R"("count":1,"first_seen_ns":)"));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+    EXPECT_THAT(json, HasSubstr("throw_stats_tests.cpp"));
+#endif
+    EXPECT_EQ(json.back(), ']');
+    EXPECT_EQ(to_json(std::span<throw_site_stats const> {}), "[]");
+}
+
+// ============================================================================
+// Rate-limited reporting
+// ============================================================================
+
+TEST(LogThrottle, AdmitsFirstThenSuppressesUntilInterval) {
+    using namespace std::chrono_literals;
+    log_throttle throttle {50ms};
+    auto const   exc = catch_counted(1);
+
+    EXPECT_EQ(throttle.admit(exc), 0U);
+    EXPECT_FALSE(throttle.admit(exc).has_value());
+    EXPECT_FALSE(throttle.admit(catch_counted(2)).has_value());  // same site, other data
+
+    std::this_thread::sleep_for(60ms);
+    EXPECT_EQ(throttle.admit(exc), 2U);
+    EXPECT_FALSE(throttle.admit(exc).has_value());
+}
+
+TEST(LogThrottle, SitesAreIndependent) {
+    using namespace std::chrono_literals;
+    log_throttle throttle {1h};
+    rare_error   rare;
+    try {
+        throw_rare();
+    } catch (rare_error const & exc) {
+        rare = exc;
+    }
+
+    EXPECT_EQ(throttle.admit(catch_counted(1)), 0U);
+    EXPECT_EQ(throttle.admit(rare), 0U);
+    EXPECT_FALSE(throttle.admit(catch_counted(1)).has_value());
+    EXPECT_FALSE(throttle.admit(rare).has_value());
+}
+
+TEST(LogThrottle, ContractSitesAreIndependent) {
+    using namespace std::chrono_literals;
+    static constexpr throw_site first {"a", "precondition"};
+    static constexpr throw_site second {"b", "precondition"};
+    // Same type and location, so only the throw site tells them apart.
+    auto const from = [](throw_site const & site) -> generic_error {
+        return generic_error().with_site(site);
+    };
+
+    log_throttle throttle {1h};
+    for (int round = 0; round < 3; ++round) {
+        EXPECT_EQ(throttle.admit(from(first)).has_value(), round == 0);
+        EXPECT_EQ(throttle.admit(from(second)).has_value(), round == 0);
+    }
+}
@@ -0,0 +1,162 @@
+//
+// Tests for hinder::catch_as_expected and hinder::value_or_throw
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+
+#include <gtest/gtest.h>
+#include <hinder/expected/bridge.h>
+
+#include <expected>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+    HINDER_DEFINE_EXCEPTION(vendor_error, hinder::generic_error);
+
+    auto vendor_parse(int value) -> int {
+        if (value < 0) {
+            HINDER_THROW(vendor_error).message("negative input").with("value", value);
+        }
+        return value * 2;
+    }
+
+    auto lookup(int key) -> std::expected<std::string, hinder::error> {
+        if (key != 0) {
+            return hinder::fail("lookup_error").message("no key {}", key).with("key", key);
+        }
+        return "zero";
+    }
+
+    // ========================================================================
+    // catch_as_expected
+    // ========================================================================
+
+    TEST(CatchAsExpected, ReturnsTheValue) {
+        auto const result = hinder::catch_as_expected([] { return vendor_parse(21); });
+        ASSERT_TRUE(result.has_value());
+        EXPECT_EQ(*result, 42);
+    }
+
+    TEST(CatchAsExpected, SupportsVoid) {
+        bool called = false;
+        auto const result = hinder::catch_as_expected([&called] { called = true; });
+        EXPECT_TRUE(result.has_value());
+        EXPECT_TRUE(called);
+    }
+
+    TEST(CatchAsExpected, ConvertsTheException) {
+        auto const result = hinder::catch_as_expected([] { return vendor_parse(-1); });
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().type_name(), "vendor_error");
+        EXPECT_EQ(result.error().get_as<std::string>("message"), "negative input");
+        EXPECT_EQ(result.error().get_as<int>("value"), -1);
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+        EXPECT_NE(std::string(result.error().location().file_name()).find("bridge_tests.cpp"),
+                  std::string::npos);
+#endif
+    }
+
+    TEST(CatchAsExpected, SharesThePayload) {
+        try {
+            vendor_parse(-1);
+            FAIL() << "Expected vendor_error";
+        } catch (vendor_error const & exc) {
+            auto const err = hinder::to_error(exc);
+            EXPECT_TRUE(err.data().shares_with(exc.data()));
+            EXPECT_EQ(err.location().line(), exc.location().line());
+        }
+    }
+
+    TEST(CatchAsExpected, OtherExceptionsPropagate) {
+        EXPECT_THROW(
+            (void)hinder::catch_as_expected([]() -> int { throw std::runtime_error("boom"); }),
+            std::runtime_error);
+    }
+
+    TEST(CatchAsExpected, DropsReferenceQualifiers) {
+        std::string const name = "value";
+        auto const result = hinder::catch_as_expected([&name]() -> std::string const & {
+            return name;
+        });
+        static_assert(std::is_same_v<std::remove_cvref_t<decltype(result)>,
+                                     std::expected<std::string, hinder::error>>);
+        EXPECT_EQ(*result, "value");
+    }
+
+    // ========================================================================
+    // value_or_throw
+    // ========================================================================
+
+    TEST(ValueOrThrow, ReturnsTheValue) { EXPECT_EQ(hinder::value_or_throw(lookup(0)), "zero"); }
+
+    TEST(ValueOrThrow, ReturnsAReferenceForLvalues) {
+        auto result = lookup(0);
+        auto & value = hinder::value_or_throw(result);
+        EXPECT_EQ(&value, &*result);
+    }
+
+    TEST(ValueOrThrow, ReturnsTheValueForRvalues) {
+        static_assert(std::is_same_v<decltype(hinder::value_or_throw(lookup(0))), std::string>);
+        auto const value = hinder::value_or_throw(lookup(0));
+        EXPECT_EQ(value, "zero");
+    }
+
+    TEST(ValueOrThrow, SupportsVoid) {
+        std::expected<void, hinder::error> const result;
+        EXPECT_NO_THROW(hinder::value_or_throw(result));
+    }
+
+    TEST(ValueOrThrow, ThrowsTheError) {
+        auto const result = lookup(7);
+        try {
+            (void)hinder::value_or_throw(result);
+            FAIL() << "Expected error_exception";
+        } catch (hinder::error_exception const & exc) {
+            EXPECT_EQ(exc.type_name(), "lookup_error");
+            EXPECT_EQ(exc.get_as<std::string>("message"), "no key 7");
+            EXPECT_EQ(exc.get_as<int>("key"), 7);
+            EXPECT_TRUE(exc.data().shares_with(result.error().data()));
+            EXPECT_EQ(exc.location().line(), result.error().location().line());
+        }
+    }
+
+    TEST(ValueOrThrow, OwnsARuntimeTypeName) {
+        std::optional<hinder::error_exception> copy;
+        {
+            std::string name = "runtime_error_name_longer_than_sso";
+            auto const  result =
+                std::expected<int, hinder::error>(std::unexpect, hinder::error(name));
+            try {
+                (void)hinder::value_or_throw(result);
+            } catch (hinder::error_exception const & exc) {
+                copy.emplace(exc);
+            }
+            name.assign(name.size(), 'x');
+        }
+        ASSERT_TRUE(copy.has_value());
+        hinder::error_exception const moved_from_copy(std::move(*copy));
+        EXPECT_EQ(moved_from_copy.type_name(), "runtime_error_name_longer_than_sso");
+        EXPECT_STREQ(copy->what(), "runtime_error_name_longer_than_sso");
+    }
+
+    TEST(ValueOrThrow, IsAGenericError) {
+        EXPECT_THROW((void)hinder::value_or_throw(lookup(1)), hinder::generic_error);
+    }
+
+    TEST(ValueOrThrow, RoundTripsThroughCatchAsExpected) {
+        auto const result =
+            hinder::catch_as_expected([] { return hinder::value_or_throw(lookup(3)); });
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().type_name(), "lookup_error");
+        EXPECT_EQ(result.error().get_as<int>("key"), 3);
+        EXPECT_EQ(hinder::to_string(result.error()), hinder::to_string(lookup(3).error()));
+    }
+
+}  // namespace
@@ -0,0 +1,124 @@
+//
+// Tests for hinder::compact_error
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+
+#include <gtest/gtest.h>
+#include <hinder/expected/compact_error.h>
+
+#include <cstdint>
+#include <expected>
+#include <source_location>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    constexpr hinder::error_descriptor not_found {"lookup_error", "key not found"};
+
+    auto lookup(int key) -> std::expected<int, hinder::compact_error> {
+        if (key == 0) {
+            return 42;
+        }
+        return std::unexpected(hinder::compact_error(not_found));
+    }
+
+    // ========================================================================
+    // Layout
+    // ========================================================================
+
+    TEST(CompactError, IsPointerSized) {
+        EXPECT_EQ(sizeof(hinder::compact_error), sizeof(void *));
+        EXPECT_LE(sizeof(std::expected<int, hinder::compact_error>), 2 * sizeof(void *));
+        EXPECT_LT(sizeof(std::expected<int, hinder::compact_error>),
+                  sizeof(std::expected<int, hinder::error>));
+    }
+
+    // ========================================================================
+    // Static descriptors
+    // ========================================================================
+
+    TEST(CompactError, StaticDescriptorAllocatesNothing) {
+        auto result = lookup(1);
+        ASSERT_FALSE(result.has_value());
+        EXPECT_TRUE(result.error().is_static());
+        EXPECT_EQ(result.error().type_name(), "lookup_error");
+        EXPECT_EQ(lookup(0).value_or(0), 42);
+    }
+
+    TEST(CompactError, StaticDescriptorConvertsToError) {
+        hinder::error const err = lookup(1).error();
+        EXPECT_EQ(err.type_name(), "lookup_error");
+        EXPECT_EQ(err.get_as<std::string>("message"), "key not found");
+        EXPECT_EQ(err.size(), 1U);
+    }
+
+    TEST(CompactError, DescriptorWithoutMessageHasNoData) {
+        static constexpr hinder::error_descriptor bare {"bare_error"};
+        EXPECT_EQ(hinder::compact_error(bare).to_error().size(), 0U);
+    }
+
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+    TEST(CompactError, DescriptorCapturesDeclarationSite) {
+        auto const line = std::source_location::current().line() + 1;
+        static constexpr hinder::error_descriptor here {"here_error"};
+        hinder::compact_error const               err(here);
+        EXPECT_EQ(err.location().line(), line);
+        EXPECT_EQ(err.to_error().location().line(), line);
+    }
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
+
+    // ========================================================================
+    // Heap errors
+    // ========================================================================
+
+    TEST(CompactError, RoundTripsFullError) {
+        auto original = hinder::error("command_error").message("exit {}", 2).with("code", 2);
+        hinder::compact_error const compact(original);
+        EXPECT_FALSE(compact.is_static());
+        EXPECT_EQ(compact.type_name(), "command_error");
+
+        hinder::error const back = compact;
+        EXPECT_EQ(back.type_name(), "command_error");
+        EXPECT_EQ(back.get_as<std::string>("message"), "exit 2");
+        EXPECT_EQ(back.get_as<std::int64_t>("code"), 2);
+        EXPECT_EQ(hinder::to_json(compact), hinder::to_json(original));
+        EXPECT_EQ(hinder::to_string(compact), hinder::to_string(original));
+    }
+
+    TEST(CompactError, CopyAndMoveShareHeapError) {
+        hinder::compact_error first(hinder::error("shared_error"));
+        hinder::compact_error second = first;
+        hinder::compact_error third  = std::move(first);
+        EXPECT_EQ(second.type_name(), "shared_error");
+        EXPECT_EQ(third.type_name(), "shared_error");
+
+        second = hinder::compact_error(not_found);
+        EXPECT_TRUE(second.is_static());
+        second = third;
+        EXPECT_EQ(second.type_name(), "shared_error");
+    }
+
+    TEST(CompactError, ConcurrentCopies) {
+        hinder::compact_error const shared(hinder::error("shared_error").with("code", 1));
+
+        std::vector<std::thread> workers;
+        for (int idx = 0; idx < 8; ++idx) {
+            workers.emplace_back([&shared]() -> void {
+                for (int round = 0; round < 1000; ++round) {
+                    hinder::compact_error copy = shared;
+                    EXPECT_EQ(copy.type_name(), "shared_error");
+                }
+            });
+        }
+        for (auto & worker : workers) {
+            worker.join();
+        }
+    }
+
+}  // namespace
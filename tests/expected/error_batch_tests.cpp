@@ -0,0 +1,221 @@
+//
+// Tests for hinder::error_batch
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+
+#include <gtest/gtest.h>
+#include <hinder/expected/error_batch.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    // Writes part of its text and then throws, to fail a message() part way.
+    struct throwing_arg {};
+
+}  // namespace
+
+template <>
+struct std::formatter<throwing_arg, char> {
+    constexpr auto parse(std::format_parse_context & ctx) -> std::format_parse_context::iterator {
+        return ctx.begin();
+    }
+
+    template <typename FormatContext>
+    auto format(throwing_arg const & /*arg*/, FormatContext & ctx) const
+        -> typename FormatContext::iterator {
+        std::ranges::copy(std::string_view("partial"), ctx.out());
+        throw std::runtime_error("format failed");
+    }
+};
+
+namespace {
+
+    auto validation_error(int line) -> hinder::error {
+        hinder::error err("validation_error");
+        err.message("bad value on line {}", line)
+            .with("line", line)
+            .with("field", "amount")
+            .with("ratio", 0.5)
+            .with("checked", true)
+            .with("size", std::uint64_t {7})
+            .with("required");
+        return err;
+    }
+
+    auto lines_of(std::string const & text) -> std::vector<std::string> {
+        std::vector<std::string> lines;
+        std::istringstream       input(text);
+        for (std::string line; std::getline(input, line);) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    // ========================================================================
+    // Storage
+    // ========================================================================
+
+    TEST(ErrorBatch, StartsEmpty) {
+        hinder::error_batch const batch;
+        EXPECT_TRUE(batch.empty());
+        EXPECT_EQ(batch.size(), 0U);
+        EXPECT_EQ(hinder::to_json(batch), "");
+    }
+
+    TEST(ErrorBatch, PushBackKeepsEveryValue) {
+        hinder::error_batch batch;
+        EXPECT_EQ(batch.push_back(validation_error(3)), 0U);
+        auto const row = batch[0];
+        EXPECT_EQ(row.type_name(), "validation_error");
+        EXPECT_EQ(row.size(), 7U);
+        EXPECT_EQ(row.get_as<std::string_view>("message"), "bad value on line 3");
+        EXPECT_EQ(row.get_as<std::int64_t>("line"), 3);
+        EXPECT_EQ(row.get_as<std::string>("field"), "amount");
+        EXPECT_EQ(row.get_as<double>("ratio"), 0.5);
+        EXPECT_EQ(row.get_as<bool>("checked"), true);
+        EXPECT_EQ(row.get_as<std::uint64_t>("size"), 7U);
+        EXPECT_TRUE(row.contains("required"));
+        EXPECT_FALSE(row.get_as<int>("required").has_value());
+        EXPECT_FALSE(row.contains("missing"));
+    }
+
+    TEST(ErrorBatch, InternsTypeNamesAndKeys) {
+        hinder::error_batch batch;
+        for (int line = 0; line < 1000; ++line) {
+            batch.push_back(validation_error(line));
+        }
+        EXPECT_EQ(batch.size(), 1000U);
+        EXPECT_EQ(batch.entry_count(), 7000U);
+        // "validation_error" plus seven keys, however many rows.
+        EXPECT_EQ(batch.dictionary_size(), 8U);
+    }
+
+    TEST(ErrorBatch, RowConvertsBackToAnError) {
+        hinder::error_batch batch;
+        auto const original = validation_error(9);
+        batch.push_back(original);
+        auto const copy = batch[0].to_error();
+        EXPECT_EQ(hinder::to_json(copy), hinder::to_json(original));
+        EXPECT_EQ(copy.location().line(), original.location().line());
+    }
+
+    TEST(ErrorBatch, RowIteratesInKeyOrder) {
+        hinder::error_batch batch;
+        batch.add("parse_error").with("b", 2).with("c", 3).with("a", 1);
+        std::vector<std::string_view> keys;
+        for (auto const & [key, value] : batch[0]) {
+            keys.push_back(key);
+        }
+        EXPECT_EQ(keys, (std::vector<std::string_view> {"a", "b", "c"}));
+    }
+
+    TEST(ErrorBatch, ToJsonMatchesTheRowAsAnError) {
+        hinder::error_batch batch;
+        batch.add("parse_error").with("zeta", 1).message("bad").with("alpha", true);
+        EXPECT_EQ(hinder::to_json(batch), hinder::to_json(batch[0].to_error()) + "\n");
+    }
+
+    // ========================================================================
+    // Builder
+    // ========================================================================
+
+    TEST(ErrorBatch, BuilderAddsRowsWithoutErrors) {
+        hinder::error_batch batch;
+        auto builder = batch.add("range_error");
+        builder.message("{} is out of range", 12).with("value", 12).with("strict");
+        EXPECT_EQ(builder.row(), 0U);
+        EXPECT_EQ(batch[0].get_as<std::string>("message"), "12 is out of range");
+        EXPECT_EQ(batch[0].get_as<int>("value"), 12);
+        EXPECT_TRUE(batch[0].contains("strict"));
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+        EXPECT_NE(std::string(batch[0].location().file_name()).find("error_batch_tests.cpp"),
+                  std::string::npos);
+#endif
+    }
+
+    TEST(ErrorBatch, BuilderRejectsAnEarlierRow) {
+        hinder::error_batch batch;
+        auto builder = batch.add("first");
+        batch.add("second");
+        EXPECT_THROW(builder.with("key", 1), hinder::error_batch_error);
+        EXPECT_EQ(batch[1].size(), 0U);
+    }
+
+    TEST(ErrorBatch, FailedMessageLeavesNoText) {
+        hinder::error_batch batch;
+        EXPECT_THROW(batch.add("format_error").message("{}", throwing_arg {}),
+                     std::runtime_error);
+        EXPECT_FALSE(batch[0].contains("message"));
+
+        batch.add("next_error").message("ok");
+        EXPECT_EQ(batch[1].get_as<std::string_view>("message"), "ok");
+    }
+
+    TEST(ErrorBatch, BuilderOverwritesARepeatedKey) {
+        hinder::error_batch batch;
+        batch.add("range_error").with("value", 1).with("value", "two");
+        EXPECT_EQ(batch[0].size(), 1U);
+        EXPECT_EQ(batch[0].get_as<std::string_view>("value"), "two");
+    }
+
+    TEST(ErrorBatch, RowsDoNotShareEntries) {
+        hinder::error_batch batch;
+        batch.add("first").with("key", 1);
+        batch.add("second").with("key", 2);
+        EXPECT_EQ(batch[0].get_as<int>("key"), 1);
+        EXPECT_EQ(batch[1].get_as<int>("key"), 2);
+        EXPECT_EQ(batch.entry_count(), 2U);
+    }
+
+    TEST(ErrorBatch, ClearKeepsTheDictionary) {
+        hinder::error_batch batch;
+        batch.push_back(validation_error(1));
+        batch.clear();
+        EXPECT_TRUE(batch.empty());
+        EXPECT_EQ(batch.entry_count(), 0U);
+        EXPECT_EQ(batch.dictionary_size(), 8U);
+        batch.add("validation_error").with("line", 4);
+        EXPECT_EQ(batch[0].get_as<int>("line"), 4);
+        EXPECT_EQ(batch.dictionary_size(), 8U);
+    }
+
+    // ========================================================================
+    // NDJSON
+    // ========================================================================
+
+    TEST(ErrorBatch, WritesOneJsonObjectPerRow) {
+        hinder::error_batch       batch;
+        std::vector<hinder::error> errors;
+        for (int line = 0; line < 3; ++line) {
+            errors.push_back(validation_error(line));
+            batch.push_back(errors.back());
+        }
+        batch.add("empty_error");
+
+        auto const lines = lines_of(hinder::to_json(batch));
+        ASSERT_EQ(lines.size(), 4U);
+        for (std::size_t idx = 0; idx < errors.size(); ++idx) {
+            EXPECT_EQ(lines[idx], hinder::to_json(errors[idx]));
+        }
+        EXPECT_EQ(lines[3], hinder::to_json(batch[3].to_error()));
+        EXPECT_EQ(hinder::to_json(batch).back(), '\n');
+    }
+
+    TEST(ErrorBatch, EscapesStrings) {
+        hinder::error_batch batch;
+        batch.add("quote_error").with("text", "say \"hi\"\n");
+        EXPECT_NE(hinder::to_json(batch).find(R"("text":"say \"hi\"\n")"), std::string::npos);
+    }
+
+}  // namespace
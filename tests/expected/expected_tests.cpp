@@ -9,10 +9,15 @@
 #include <gtest/gtest.h>
 #include <hinder/expected/error.h>
 
+#include <array>
 #include <cstdint>
 #include <expected>
 #include <format>
+#include <iterator>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <variant>
 
@@ -32,11 +37,31 @@ namespace {
         EXPECT_EQ(err.type_name(), "command_error");
     }
 
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
     TEST(ErrorConstruction, CapturesSourceLocation) {
         auto err = hinder::error("test_error");
         EXPECT_NE(err.location().file_name(), nullptr);
         EXPECT_GT(err.location().line(), 0U);
     }
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
+
+    TEST(ErrorConstruction, CopySharesLongTypeName) {
+        std::string name(hinder::detail::error_type_name::inline_capacity + 1, 'n');
+        auto const  err = hinder::error(name).with("code", 1);
+        name.assign(name.size(), 'x');
+
+        auto const copy = err;  // NOLINT(performance-unnecessary-copy-initialization)
+        EXPECT_EQ(copy.type_name(), std::string(name.size(), 'n'));
+        EXPECT_EQ(copy.type_name().data(), err.type_name().data());
+        EXPECT_TRUE(copy.data().shares_with(err.data()));
+    }
+
+    TEST(ErrorConstruction, CopiesShortTypeNameInPlace) {
+        auto const err  = hinder::error("short_error");
+        auto const copy = err;  // NOLINT(performance-unnecessary-copy-initialization)
+        EXPECT_EQ(copy.type_name(), "short_error");
+        EXPECT_NE(copy.type_name().data(), err.type_name().data());
+    }
 
     TEST(ErrorConstruction, EmptyByDefault) {
         auto err = hinder::error();
@@ -62,6 +87,15 @@ namespace {
         EXPECT_EQ(*msg, "exit code: 42");
     }
 
+    TEST(FluentApi, MessageIsFormattedFromCapturedCopies) {
+        std::string command = "ls";
+        auto        err     = hinder::error().message("failed to execute: {}", command);
+        auto        copy    = err;
+        command             = "rm";
+        EXPECT_EQ(err.get_as<std::string>("message"), "failed to execute: ls");
+        EXPECT_EQ(copy.get_as<std::string>("message"), "failed to execute: ls");
+    }
+
     TEST(FluentApi, WithStringValue) {
         auto err = hinder::error().with("path", "/etc/config");
         auto val = err.get_as<std::string>("path");
@@ -142,6 +176,27 @@ namespace {
         EXPECT_FALSE(val.has_value());
     }
 
+    TEST(Accessors, GetRefAndStringViewDoNotCopy) {
+        auto err = hinder::error().with("path", "/a/path/long/enough/to/allocate");
+        auto const * val = err.get_ref("path");
+        ASSERT_NE(val, nullptr);
+        EXPECT_EQ(err.get_as<std::string_view>("path")->data(),
+                  std::get<std::string>(*val).data());
+        EXPECT_EQ(err.get_ref("missing"), nullptr);
+    }
+
+    TEST(Accessors, VisitCallsWithStoredAlternative) {
+        auto err     = hinder::error().with("retried", true);
+        bool visited = false;
+        EXPECT_TRUE(err.visit("retried", [&visited](auto const & val) -> void {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(val)>, bool>) {
+                visited = val;
+            }
+        }));
+        EXPECT_TRUE(visited);
+        EXPECT_FALSE(err.visit("missing", [](auto const &) -> void {}));
+    }
+
     // ========================================================================
     // iteration
     // ========================================================================
@@ -174,11 +229,13 @@ namespace {
         EXPECT_EQ(unexpected.error().type_name(), "command_error");
     }
 
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
     TEST(FailFactory, CapturesSourceLocation) {
         auto builder    = hinder::fail("test");
         auto unexpected = std::unexpected<hinder::error>(std::move(builder));
         EXPECT_GT(unexpected.error().location().line(), 0U);
     }
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
 
     TEST(FailFactory, FluentChaining) {
         auto builder = hinder::fail("cmd_error").message("failed: {}", "ls").with("exit_code", 1);
@@ -251,7 +308,11 @@ namespace {
     TEST(Formatting, ToStringHeader) {
         auto err = hinder::error("file_error");
         auto str = hinder::to_string(err);
-        EXPECT_TRUE(str.starts_with("file_error @"));
+        if constexpr (hinder::source_info::enabled) {
+            EXPECT_TRUE(str.starts_with("file_error @"));
+        } else {
+            EXPECT_EQ(str, "file_error");
+        }
     }
 
     TEST(Formatting, ToStringContainsKeyValuePairs) {
@@ -281,6 +342,10 @@ namespace {
     TEST(Formatting, ToJsonContainsSource) {
         auto err  = hinder::error("test");
         auto json = hinder::to_json(err);
+        if constexpr (!hinder::source_info::enabled) {
+            EXPECT_EQ(json.find("\"source\""), std::string::npos);
+            return;
+        }
         EXPECT_NE(json.find("\"source\""), std::string::npos);
         EXPECT_NE(json.find("\"file\""), std::string::npos);
         EXPECT_NE(json.find("\"line\""), std::string::npos);
@@ -305,6 +370,90 @@ namespace {
         EXPECT_NE(json.find("\\\"hello\\\""), std::string::npos);
     }
 
+    TEST(Formatting, ToJsonToMatchesToJson) {
+        auto err = hinder::error("test").with("msg", "say \"hello\"").with("flag");
+        err.with_frame("loading");
+
+        std::string json;
+        hinder::to_json_to(std::back_inserter(json), err);
+        EXPECT_EQ(json, hinder::to_json(err));
+
+        std::string text;
+        hinder::to_string_to(std::back_inserter(text), err);
+        EXPECT_EQ(text, hinder::to_string(err));
+    }
+
+    TEST(Formatting, Formatter) {
+        auto const err = hinder::error("test").with("msg", "say \"hello\"").with("flag");
+        EXPECT_EQ(std::format("{}", err), hinder::to_string(err));
+        EXPECT_EQ(std::format("{:j}", err), hinder::to_json(err));
+        auto const compact = std::format("{:c}", err);
+        EXPECT_TRUE(compact.starts_with("test"));
+        EXPECT_NE(compact.find(R"( msg="say \"hello\"")"), std::string::npos);
+        EXPECT_NE(compact.find(" flag"), std::string::npos);
+
+        std::string line;
+        std::format_to(std::back_inserter(line), "error: {:j}", err);
+        EXPECT_EQ(line, "error: " + hinder::to_json(err));
+    }
+
+    TEST(Formatting, ErrorFromJsonRoundTrips) {
+        auto const err = hinder::error("parse_error")
+                             .message("bad token \"{}\"", "}")
+                             .with("line", 7)
+                             .with("strict");
+        auto const parsed = hinder::error_from_json(hinder::to_json(err));
+        ASSERT_TRUE(parsed.has_value()) << hinder::to_string(parsed.error());
+        EXPECT_EQ(parsed->type_name(), "parse_error");
+        EXPECT_EQ(parsed->get_as<std::string>("message"), "bad token \"}\"");
+        EXPECT_EQ(parsed->get_as<int>("line"), 7);
+        EXPECT_TRUE(parsed->contains("strict"));
+        EXPECT_EQ(parsed->size(), err.size());
+    }
+
+    TEST(Formatting, ErrorFromJsonReportsMalformedInput) {
+        auto const parsed = hinder::error_from_json(R"({"type":"t","data":{"k":}})");
+        ASSERT_FALSE(parsed.has_value());
+        EXPECT_EQ(parsed.error().type_name(), "json_error");
+        EXPECT_EQ(parsed.error().get_as<std::size_t>("offset"), 24U);
+        EXPECT_EQ(parsed.error().get_as<std::string>("message"),
+                  "unexpected character at offset 24");
+    }
+
+    TEST(Formatting, ErrorFromBinaryRoundTrips) {
+        hinder::key_dictionary const keys {"message", "line"};
+        auto const err = hinder::error("parse_error")
+                             .message("bad token")
+                             .with("line", 7U)
+                             .with("ratio", 0.5)
+                             .with("strict");
+        auto const parsed = hinder::error_from_binary(hinder::to_binary(err, &keys), &keys);
+        ASSERT_TRUE(parsed.has_value()) << hinder::to_string(parsed.error());
+        EXPECT_EQ(parsed->type_name(), "parse_error");
+        EXPECT_EQ(parsed->get_as<std::string>("message"), "bad token");
+        EXPECT_EQ(parsed->get("line"), hinder::exception_value {std::uint64_t {7}});
+        EXPECT_EQ(parsed->get_as<double>("ratio"), 0.5);
+        EXPECT_TRUE(parsed->contains("strict"));
+        EXPECT_EQ(parsed->size(), err.size());
+    }
+
+    TEST(Formatting, ErrorFromBinaryReportsMalformedInput) {
+        auto const parsed = hinder::error_from_binary(std::string_view("\x01", 1));
+        ASSERT_FALSE(parsed.has_value());
+        EXPECT_EQ(parsed.error().type_name(), "binary_error");
+        EXPECT_EQ(parsed.error().get_as<std::size_t>("offset"), 1U);
+        EXPECT_EQ(parsed.error().get_as<std::string>("message"), "truncated record at offset 1");
+    }
+
+    TEST(Formatting, ToJsonToSpanTruncates) {
+        auto const err  = hinder::error("test").with("count", 3);
+        auto const json = hinder::to_json(err);
+
+        std::array<char, 10> buffer {};
+        EXPECT_EQ(hinder::to_json_to(std::span<char>(buffer), err), json.size());
+        EXPECT_EQ(std::string_view(buffer.data(), buffer.size()), json.substr(0, buffer.size()));
+    }
+
     // ========================================================================
     // HINDER_FAIL macro
     // ========================================================================
@@ -334,11 +483,13 @@ namespace {
         EXPECT_TRUE(result.error().contains("exit_code"));
     }
 
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
     TEST(HinderFail, CapturesSourceLocation) {
         auto result = []() -> std::expected<int, hinder::error> {
             return HINDER_FAIL("test_error", "oops");
         }();
         EXPECT_GT(result.error().location().line(), 0U);
     }
+#endif  // HINDER_WITH_EXCEPTION_SOURCE
 
 }  // namespace
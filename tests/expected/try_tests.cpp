@@ -0,0 +1,165 @@
+//
+// Tests for HINDER_TRY
+//
+// MIT License
+//
+// Copyright (c) 2019-2026  Tony Walker
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <hinder/expected/bridge.h>
+#include <hinder/expected/error.h>
+
+#include <expected>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace {
+
+    using ::testing::HasSubstr;
+
+    auto parse_digit(char chr) -> std::expected<int, hinder::error> {
+        if (chr < '0' || chr > '9') {
+            return hinder::fail("parse_error")
+                .message("not a digit")
+                .with("char", std::string(1, chr));
+        }
+        return chr - '0';
+    }
+
+    auto parse_pair(std::string_view text) -> std::expected<int, hinder::error> {
+        auto const tens = HINDER_TRY(parse_digit(text[0]), "tens");
+        auto const ones = HINDER_TRY(parse_digit(text[1]));
+        return (tens * 10) + ones;
+    }
+
+    auto check(bool good) -> std::expected<void, hinder::error> {
+        if (!good) {
+            return hinder::fail("check_error").message("bad");
+        }
+        return {};
+    }
+
+    auto checked(bool good) -> std::expected<int, hinder::error> {
+        HINDER_TRY(check(good), "checking");
+        return 2;
+    }
+
+    // The payload block created at the bottom of layer(); compared to prove it is never copied.
+    hinder::exception_data::const_iterator bottom_entries {nullptr};
+
+    template <int Depth>
+    auto layer() -> std::expected<int, hinder::error> {
+        if constexpr (Depth == 0) {
+            hinder::error err("deep_error");
+            err.with("depth", 0);
+            bottom_entries = err.data().begin();
+            return std::unexpected(std::move(err));
+        } else {
+            return HINDER_TRY(layer<Depth - 1>()) + 1;
+        }
+    }
+
+    // ========================================================================
+    // Values and errors
+    // ========================================================================
+
+    TEST(Try, YieldsTheValue) { EXPECT_EQ(parse_pair("42"), 42); }
+
+    TEST(Try, SupportsVoid) { EXPECT_EQ(checked(true), 2); }
+
+    TEST(Try, PropagatesTheError) {
+        auto const result = parse_pair("4x");
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().type_name(), "parse_error");
+        EXPECT_EQ(result.error().get_as<std::string>("char"), "x");
+        ASSERT_EQ(result.error().frames().size(), 1U);
+        EXPECT_EQ(result.error().frames()[0].note, nullptr);
+    }
+
+    TEST(Try, RecordsTheNoteAndLocation) {
+        auto const result = checked(false);
+        ASSERT_FALSE(result.has_value());
+        ASSERT_EQ(result.error().frames().size(), 1U);
+        auto const & frame = result.error().frames()[0];
+        EXPECT_STREQ(frame.note, "checking");
+#if defined(HINDER_WITH_EXCEPTION_SOURCE)
+        EXPECT_THAT(frame.location.file_name(), HasSubstr("try_tests.cpp"));
+        EXPECT_GT(frame.location.line(), result.error().location().line());
+#endif
+    }
+
+    TEST(Try, LeavesAnLvalueUnchanged) {
+        auto const source = parse_digit('x');
+        auto const forward = [&source]() -> std::expected<int, hinder::error> {
+            return HINDER_TRY(source);
+        };
+        auto const result = forward();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().frames().size(), 1U);
+        EXPECT_TRUE(source.error().frames().empty());
+        EXPECT_EQ(source.error().get_as<std::string>("char"), "x");
+    }
+
+    // ========================================================================
+    // Deep propagation
+    // ========================================================================
+
+    TEST(Try, DeepPropagationKeepsOneBlock) {
+        auto const result = layer<20>();
+        ASSERT_FALSE(result.has_value());
+        // The block allocated at the bottom carries all 20 frames: no level copied it.
+        EXPECT_EQ(result.error().data().begin(), bottom_entries);
+        EXPECT_EQ(result.error().frames().size(), 20U);
+        EXPECT_EQ(result.error().dropped_frames(), 0U);
+    }
+
+    TEST(Try, CountsFramesPastCapacity) {
+        auto const result   = layer<30>();
+        auto const capacity = hinder::exception_data::frame_capacity;
+        ASSERT_FALSE(result.has_value());
+        EXPECT_EQ(result.error().frames().size(), capacity);
+        EXPECT_EQ(result.error().dropped_frames(), 30 - capacity);
+    }
+
+    TEST(Try, CopiesKeepTheirOwnFrames) {
+        auto const result = layer<1>();
+        auto       copy   = result.error();
+        copy.with_frame("extra");
+        EXPECT_EQ(result.error().frames().size(), 1U);
+        EXPECT_EQ(copy.frames().size(), 2U);
+    }
+
+    // ========================================================================
+    // Formatting
+    // ========================================================================
+
+    TEST(Try, FormatsTheContext) {
+        auto const result = checked(false);
+        ASSERT_FALSE(result.has_value());
+        EXPECT_THAT(hinder::to_string(result.error()), HasSubstr("\n  context:\n    #0"));
+        EXPECT_THAT(hinder::to_string(result.error()), HasSubstr(" checking"));
+        EXPECT_THAT(hinder::to_json(result.error()), HasSubstr(R"("note":"checking"})"));
+        EXPECT_THAT(hinder::to_json(result.error()), HasSubstr(R"(,"context":[{)"));
+    }
+
+    TEST(Try, ReportsDroppedFrames) {
+        auto const result = layer<30>();
+        ASSERT_FALSE(result.has_value());
+        EXPECT_THAT(hinder::to_string(result.error()), HasSubstr("... 6 more"));
+        EXPECT_THAT(hinder::to_json(result.error()), HasSubstr(R"(,"context_dropped":6)"));
+    }
+
+    TEST(Try, ContextSurvivesValueOrThrow) {
+        try {
+            (void)hinder::value_or_throw(checked(false));
+            FAIL() << "Expected error_exception";
+        } catch (hinder::error_exception const & exc) {
+            ASSERT_EQ(exc.frames().size(), 1U);
+            EXPECT_THAT(hinder::to_json(exc), HasSubstr(R"("note":"checking"})"));
+        }
+    }
+
+}  // namespace
@@ -0,0 +1,219 @@
+//
+// hinder::queue
+//
+// MIT License
+//
+// Copyright (c) 2017-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <hinder/combining_queue.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Basic single-threaded round-trip
+// ============================================================================
+
+TEST(CombiningQueue, PushPop)
+{
+    hinder::combining_queue<int> que;
+    EXPECT_TRUE(que.push(42));
+    const auto result = que.pop(100ms);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 42);
+}
+
+TEST(CombiningQueue, Fifo)
+{
+    hinder::combining_queue<int> que;
+    for (int idx = 0; idx < 10; ++idx) {
+        EXPECT_TRUE(que.push(idx));
+    }
+    for (int idx = 0; idx < 10; ++idx) {
+        EXPECT_EQ(que.pop(100ms), idx);
+    }
+}
+
+// ============================================================================
+// Bounded queue: push to capacity, then time out
+// ============================================================================
+
+TEST(CombiningQueue, Bound)
+{
+    hinder::combining_queue<int> que(2);
+    EXPECT_EQ(que.size(), 0);
+    EXPECT_TRUE(que.empty());
+
+    EXPECT_TRUE(que.push(1));
+    EXPECT_TRUE(que.push(2));
+    EXPECT_EQ(que.size(), 2);
+    EXPECT_FALSE(que.empty());
+
+    // Queue is full; next push should time out and return false.
+    EXPECT_FALSE(que.push(3, 10ms));
+}
+
+TEST(CombiningQueue, Timeout)
+{
+    hinder::combining_queue<int> que;
+    const auto result = que.pop(10ms);
+    EXPECT_FALSE(result.has_value());
+}
+
+// ============================================================================
+// Move semantics: a failed push leaves the value with the caller
+// ============================================================================
+
+TEST(CombiningQueue, MoveSemantics)
+{
+    hinder::combining_queue<std::unique_ptr<int>> que(1);
+
+    auto ptr = std::make_unique<int>(99);
+    EXPECT_TRUE(que.push(std::move(ptr)));
+    EXPECT_EQ(ptr, nullptr);  // ownership transferred
+
+    auto other = std::make_unique<int>(7);
+    EXPECT_FALSE(que.push(std::move(other), 10ms));
+    ASSERT_NE(other, nullptr);  // full: ownership retained
+    EXPECT_EQ(*other, 7);
+
+    const auto result = que.pop(100ms);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(**result, 99);
+}
+
+// ============================================================================
+// Blocking: a waiting consumer is woken by a later push
+// ============================================================================
+
+TEST(CombiningQueue, BlockedPopWakesOnPush)
+{
+    hinder::combining_queue<int> que;
+    std::thread producer([&] {
+        std::this_thread::sleep_for(20ms);
+        EXPECT_TRUE(que.push(5));
+    });
+    const auto result = que.pop(5s);
+    producer.join();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(*result, 5);
+}
+
+TEST(CombiningQueue, BlockedPushWakesOnPop)
+{
+    hinder::combining_queue<int> que(1);
+    EXPECT_TRUE(que.push(1));
+    std::thread consumer([&] {
+        std::this_thread::sleep_for(20ms);
+        EXPECT_EQ(que.pop(), 1);
+    });
+    EXPECT_TRUE(que.push(2, 5s));
+    consumer.join();
+    EXPECT_EQ(que.pop(100ms), 2);
+}
+
+// ============================================================================
+// close(): blocks new pushes, drains existing items, wakes waiters
+// ============================================================================
+
+TEST(CombiningQueue, CloseDrains)
+{
+    hinder::combining_queue<int> que;
+    EXPECT_TRUE(que.push(1));
+    que.close();
+    EXPECT_TRUE(que.closed());
+    EXPECT_FALSE(que.push(2));
+    EXPECT_EQ(que.pop(), 1);
+    EXPECT_FALSE(que.pop().has_value());
+}
+
+TEST(CombiningQueue, CloseWakesBlockedConsumer)
+{
+    hinder::combining_queue<int> que;
+    std::thread closer([&] {
+        std::this_thread::sleep_for(20ms);
+        que.close();
+    });
+    EXPECT_FALSE(que.pop(5s).has_value());
+    closer.join();
+}
+
+// ============================================================================
+// MPMC stress test: more threads than a mutex convoy handles gracefully
+// ============================================================================
+
+TEST(CombiningQueue, MPMC)
+{
+    constexpr int num_producers      = 8;
+    constexpr int num_consumers      = 8;
+    constexpr int items_per_producer = 2'000;
+    constexpr long long total        = num_producers * items_per_producer;
+
+    hinder::combining_queue<int> que(64);
+    std::atomic<int>             consumed {0};
+    std::atomic<long long>       sum {0};
+
+    std::vector<std::thread> consumers;
+    consumers.reserve(num_consumers);
+    for (int idx = 0; idx < num_consumers; ++idx) {
+        consumers.emplace_back([&] {
+            while (const auto val = que.pop()) {
+                consumed.fetch_add(1, std::memory_order_relaxed);
+                sum.fetch_add(*val, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    producers.reserve(num_producers);
+    for (int idx = 0; idx < num_producers; ++idx) {
+        producers.emplace_back([&] {
+            for (int jdx = 0; jdx < items_per_producer; ++jdx) {
+                EXPECT_TRUE(que.push(jdx));
+            }
+        });
+    }
+
+    for (auto& thd : producers) {
+        thd.join();
+    }
+    que.close();
+    for (auto& thd : consumers) {
+        thd.join();
+    }
+
+    EXPECT_EQ(consumed.load(), total);
+    EXPECT_EQ(sum.load(), num_producers * (items_per_producer * (items_per_producer - 1LL) / 2));
+}
+
+// ============================================================================
+// Precondition: bound must be > 0
+// ============================================================================
+
+TEST(CombiningQueue, ZeroBoundThrows)
+{
+    EXPECT_THROW(hinder::combining_queue<int>(0), hinder::queue_error);
+}
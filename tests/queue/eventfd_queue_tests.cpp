@@ -0,0 +1,216 @@
+//
+// hinder::queue
+//
+// MIT License
+//
+// Copyright (c) 2017-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <hinder/eventfd_notifier.h>
+#include <iterator>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    // Output iterator that throws once it has written limit items.
+    struct throwing_output {
+        using difference_type = std::ptrdiff_t;
+
+        std::vector<int> * out;
+        std::size_t        limit;
+
+        auto operator*() -> throwing_output & { return *this; }
+        auto operator=(int value) -> throwing_output &
+        {
+            if (out->size() == limit) {
+                throw std::runtime_error("output full");
+            }
+            out->push_back(value);
+            return *this;
+        }
+        auto operator++() -> throwing_output & { return *this; }
+        auto operator++(int) -> throwing_output { return *this; }
+    };
+
+    auto readable(int fd) -> bool
+    {
+        pollfd pfd {.fd = fd, .events = POLLIN, .revents = 0};
+        return ::poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLIN) != 0;
+    }
+
+}  // namespace
+
+// ============================================================================
+// Non-blocking bulk pop (available on every hinder::queue)
+// ============================================================================
+
+TEST(Queue, TryPopBulk)
+{
+    hinder::queue<int> que;
+    std::vector<int>   out;
+    EXPECT_EQ(que.try_pop_bulk(std::back_inserter(out)), 0);
+
+    for (int idx = 0; idx < 5; ++idx) {
+        EXPECT_TRUE(que.push(idx));
+    }
+    EXPECT_EQ(que.try_pop_bulk(std::back_inserter(out), 3), 3);
+    EXPECT_EQ(out, (std::vector<int> {0, 1, 2}));
+    EXPECT_EQ(que.size(), 2);
+
+    EXPECT_EQ(que.try_pop_bulk(std::back_inserter(out)), 2);
+    EXPECT_EQ(out, (std::vector<int> {0, 1, 2, 3, 4}));
+    EXPECT_TRUE(que.empty());
+}
+
+TEST(Queue, TryPopBulkKeepsSizeWhenOutputThrows)
+{
+    hinder::queue<int> que(4);
+    for (int idx = 0; idx < 4; ++idx) {
+        EXPECT_TRUE(que.push(idx));
+    }
+    std::vector<int> out;
+    EXPECT_THROW(que.try_pop_bulk(throwing_output {&out, 2}), std::runtime_error);
+    EXPECT_EQ(out, (std::vector<int> {0, 1}));
+    EXPECT_EQ(que.size(), 2);
+    EXPECT_TRUE(que.push(4, 0ms));
+}
+
+TEST(Queue, TryPopBulkUnblocksProducer)
+{
+    hinder::queue<int> que(1);
+    EXPECT_TRUE(que.push(1));
+    std::thread consumer([&] {
+        std::this_thread::sleep_for(20ms);
+        std::vector<int> out;
+        EXPECT_EQ(que.try_pop_bulk(std::back_inserter(out)), 1);
+    });
+    EXPECT_TRUE(que.push(2, 5s));
+    consumer.join();
+}
+
+// ============================================================================
+// eventfd notification
+// ============================================================================
+
+TEST(EventfdQueue, NotReadableWhenEmpty)
+{
+    hinder::eventfd_queue<int> que;
+    EXPECT_GE(que.notifier().fd(), 0);
+    EXPECT_FALSE(readable(que.notifier().fd()));
+}
+
+TEST(EventfdQueue, BurstIsCoalesced)
+{
+    hinder::eventfd_queue<int> que;
+    for (int idx = 0; idx < 100; ++idx) {
+        EXPECT_TRUE(que.push(idx));
+    }
+    ASSERT_TRUE(readable(que.notifier().fd()));
+
+    // Only one notification was written for the whole burst.
+    std::uint64_t count = 0;
+    ASSERT_EQ(::read(que.notifier().fd(), &count, sizeof(count)), sizeof(count));
+    EXPECT_EQ(count, 1U);
+}
+
+TEST(EventfdQueue, ResetRearms)
+{
+    hinder::eventfd_queue<int> que;
+    EXPECT_TRUE(que.push(1));
+    EXPECT_TRUE(readable(que.notifier().fd()));
+
+    que.notifier().reset();
+    EXPECT_FALSE(readable(que.notifier().fd()));
+    std::vector<int> out;
+    EXPECT_EQ(que.try_pop_bulk(std::back_inserter(out)), 1);
+
+    EXPECT_TRUE(que.push(2));
+    EXPECT_TRUE(readable(que.notifier().fd()));
+}
+
+TEST(EventfdQueue, EpollLoopDrainsEverything)
+{
+    constexpr int total = 1'000;
+
+    hinder::eventfd_queue<int> que;
+    const int                  epfd = ::epoll_create1(EPOLL_CLOEXEC);
+    ASSERT_GE(epfd, 0);
+    epoll_event ev {};
+    ev.events = EPOLLIN;
+    ASSERT_EQ(::epoll_ctl(epfd, EPOLL_CTL_ADD, que.notifier().fd(), &ev), 0);
+
+    std::thread producer([&] {
+        for (int idx = 0; idx < total; ++idx) {
+            EXPECT_TRUE(que.push(idx));
+        }
+    });
+
+    std::vector<int> received;
+    while (received.size() < total) {
+        epoll_event ready {};
+        ASSERT_EQ(::epoll_wait(epfd, &ready, 1, 5'000), 1);
+        que.notifier().reset();
+        que.try_pop_bulk(std::back_inserter(received));
+    }
+    producer.join();
+    ::close(epfd);
+
+    ASSERT_EQ(received.size(), total);
+    for (int idx = 0; idx < total; ++idx) {
+        EXPECT_EQ(received[idx], idx);
+    }
+}
+
+TEST(EventfdQueue, BoundedBatchesDrainUntilEmpty)
+{
+    constexpr int total     = 100;
+    constexpr int max_items = 8;
+
+    hinder::eventfd_queue<int> que;
+    for (int idx = 0; idx < total; ++idx) {
+        EXPECT_TRUE(que.push(idx));
+    }
+    ASSERT_TRUE(readable(que.notifier().fd()));
+    que.notifier().reset();
+
+    // One batch leaves items queued without a pending wakeup: the consumer must keep draining.
+    std::vector<int> received;
+    EXPECT_EQ(que.try_pop_bulk(std::back_inserter(received), max_items), max_items);
+    EXPECT_FALSE(readable(que.notifier().fd()));
+    EXPECT_EQ(que.size(), total - max_items);
+
+    while (que.try_pop_bulk(std::back_inserter(received), max_items) != 0) {
+    }
+    ASSERT_EQ(received.size(), total);
+    for (int idx = 0; idx < total; ++idx) {
+        EXPECT_EQ(received[idx], idx);
+    }
+    EXPECT_TRUE(que.empty());
+}
@@ -0,0 +1,177 @@
+//
+// hinder::object_pool
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <hinder/object_pool.h>
+#include <hinder/queue.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    // Counts live instances to verify construction/destruction pairing.
+    struct widget {
+        static inline std::atomic<int> live {0};
+
+        explicit widget(int val) : value(val) { live.fetch_add(1); }
+        ~widget() { live.fetch_sub(1); }
+
+        widget(const widget&)                    = delete;
+        auto operator=(const widget&) -> widget& = delete;
+        widget(widget&&)                         = delete;
+        auto operator=(widget&&) -> widget&      = delete;
+
+        int         value;
+        std::string payload {"a string long enough to defeat the small string optimization"};
+    };
+
+    struct throws_on_construct {
+        explicit throws_on_construct(bool fail)
+        {
+            if (fail) {
+                throw std::runtime_error("construction failed");
+            }
+        }
+    };
+
+}  // namespace
+
+// ============================================================================
+// Single-threaded: construction, destruction, reuse
+// ============================================================================
+
+TEST(ObjectPool, AcquireConstructsAndReleaseDestroys)
+{
+    hinder::object_pool<widget> pool;
+    {
+        auto obj = pool.acquire(7);
+        ASSERT_NE(obj, nullptr);
+        EXPECT_EQ(obj->value, 7);
+        EXPECT_EQ(widget::live.load(), 1);
+    }
+    EXPECT_EQ(widget::live.load(), 0);
+}
+
+TEST(ObjectPool, StorageIsRecycled)
+{
+    hinder::object_pool<widget> pool;
+    for (int idx = 0; idx < 1'000; ++idx) {
+        auto obj = pool.acquire(idx);
+        EXPECT_EQ(obj->value, idx);
+    }
+    EXPECT_EQ(pool.allocated(), 1U);
+}
+
+TEST(ObjectPool, ConstructorExceptionReturnsStorage)
+{
+    hinder::object_pool<throws_on_construct> pool;
+    EXPECT_THROW((void)pool.acquire(true), std::runtime_error);
+    auto obj = pool.acquire(false);
+    EXPECT_EQ(pool.allocated(), 1U);
+}
+
+TEST(ObjectPool, DefaultHandleIsEmpty)
+{
+    hinder::object_pool<widget>::handle obj;
+    EXPECT_EQ(obj, nullptr);
+}
+
+// ============================================================================
+// Cross-thread hand-off through hinder::queue
+// ============================================================================
+
+TEST(ObjectPool, QueueHandOffStopsAllocating)
+{
+    constexpr int total = 20'000;
+    constexpr int bound = 16;
+
+    hinder::object_pool<widget>                       pool;
+    hinder::queue<hinder::object_pool<widget>::handle> que(bound);
+    long long                                         sum = 0;
+
+    std::thread consumer([&] {
+        while (auto obj = que.pop()) {
+            sum += (*obj)->value;
+        }  // handle destroyed here: storage returns to the consumer's cache
+    });
+
+    for (int idx = 0; idx < total; ++idx) {
+        ASSERT_TRUE(que.push(pool.acquire(idx)));
+    }
+    que.close();
+    consumer.join();
+
+    EXPECT_EQ(sum, static_cast<long long>(total) * (total - 1) / 2);
+    EXPECT_EQ(widget::live.load(), 0);
+    // Storage circulates producer -> queue -> consumer cache -> global list -> producer cache.
+    // The footprint is bounded by what can be in flight, not by the number of items.
+    EXPECT_LT(pool.allocated(), bound + 4 * hinder::object_pool<widget>::default_thread_cache_size);
+}
+
+// ============================================================================
+// Lifetime: thread caches outliving their pool, several pools per thread
+// ============================================================================
+
+TEST(ObjectPool, ThreadExitAfterPoolDestroyed)
+{
+    std::atomic<bool> pool_gone {false};
+    std::atomic<bool> cached {false};
+    std::thread       worker;
+    {
+        hinder::object_pool<widget> pool;
+        worker = std::thread([&] {
+            (void)pool.acquire(1);  // leaves the storage in this thread's cache
+            cached.store(true);
+            while (!pool_gone.load()) {
+                std::this_thread::yield();
+            }
+        });
+        while (!cached.load()) {
+            std::this_thread::yield();
+        }
+    }
+    pool_gone.store(true);
+    worker.join();  // the cache must not touch the destroyed pool
+    SUCCEED();
+}
+
+TEST(ObjectPool, MultiplePoolsPerThread)
+{
+    hinder::object_pool<widget> first;
+    hinder::object_pool<widget> second;
+    for (int idx = 0; idx < 100; ++idx) {
+        auto one = first.acquire(1);
+        auto two = second.acquire(2);
+        EXPECT_EQ(one->value + two->value, 3);
+    }
+    EXPECT_EQ(first.allocated(), 1U);
+    EXPECT_EQ(second.allocated(), 1U);
+}
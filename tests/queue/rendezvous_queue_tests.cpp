@@ -0,0 +1,188 @@
+//
+// hinder::queue
+//
+// MIT License
+//
+// Copyright (c) 2017-2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <hinder/rendezvous_queue.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Timeouts: nothing to rendezvous with
+// ============================================================================
+
+TEST(RendezvousQueue, PushTimesOutWithoutConsumer)
+{
+    hinder::rendezvous_queue<int> que;
+    EXPECT_FALSE(que.push(1, 10ms));
+}
+
+TEST(RendezvousQueue, PopTimesOutWithoutProducer)
+{
+    hinder::rendezvous_queue<int> que;
+    EXPECT_FALSE(que.pop(10ms).has_value());
+}
+
+// ============================================================================
+// Hand-off: push() returns only after the consumer has the item
+// ============================================================================
+
+TEST(RendezvousQueue, HandOff)
+{
+    hinder::rendezvous_queue<int> que;
+    std::atomic<bool>             received {false};
+
+    std::thread consumer([&] {
+        std::this_thread::sleep_for(20ms);
+        const auto val = que.pop(5s);
+        ASSERT_TRUE(val.has_value());
+        EXPECT_EQ(*val, 42);
+        received.store(true);
+    });
+
+    EXPECT_TRUE(que.push(42, 5s));
+    consumer.join();
+    EXPECT_TRUE(received.load());
+}
+
+TEST(RendezvousQueue, ConsumerWaitsForProducer)
+{
+    hinder::rendezvous_queue<int> que;
+    std::thread                   producer([&] {
+        std::this_thread::sleep_for(20ms);
+        EXPECT_TRUE(que.push(7, 5s));
+    });
+    EXPECT_EQ(que.pop(5s), 7);
+    producer.join();
+}
+
+// ============================================================================
+// Move semantics: transferred on success, untouched on failure
+// ============================================================================
+
+TEST(RendezvousQueue, MoveSemantics)
+{
+    hinder::rendezvous_queue<std::unique_ptr<int>> que;
+
+    auto kept = std::make_unique<int>(1);
+    EXPECT_FALSE(que.push(std::move(kept), 10ms));
+    ASSERT_NE(kept, nullptr);
+
+    std::thread consumer([&] {
+        const auto val = que.pop(5s);
+        ASSERT_TRUE(val.has_value());
+        EXPECT_EQ(**val, 99);
+    });
+    auto ptr = std::make_unique<int>(99);
+    EXPECT_TRUE(que.push(std::move(ptr), 5s));
+    EXPECT_EQ(ptr, nullptr);
+    consumer.join();
+}
+
+// ============================================================================
+// close(): wakes waiters and rejects new work
+// ============================================================================
+
+TEST(RendezvousQueue, CloseWakesProducer)
+{
+    hinder::rendezvous_queue<int> que;
+    std::thread                   closer([&] {
+        std::this_thread::sleep_for(20ms);
+        que.close();
+    });
+    EXPECT_FALSE(que.push(1, 5s));
+    closer.join();
+    EXPECT_TRUE(que.closed());
+}
+
+TEST(RendezvousQueue, CloseWakesConsumer)
+{
+    hinder::rendezvous_queue<int> que;
+    std::thread                   closer([&] {
+        std::this_thread::sleep_for(20ms);
+        que.close();
+    });
+    EXPECT_FALSE(que.pop(5s).has_value());
+    closer.join();
+}
+
+TEST(RendezvousQueue, ClosedRejectsImmediately)
+{
+    hinder::rendezvous_queue<int> que;
+    que.close();
+    que.close();  // idempotent
+    EXPECT_FALSE(que.push(1));
+    EXPECT_FALSE(que.pop().has_value());
+}
+
+// ============================================================================
+// MPMC stress test: every successful push is received exactly once
+// ============================================================================
+
+TEST(RendezvousQueue, MPMC)
+{
+    constexpr int num_producers      = 4;
+    constexpr int num_consumers      = 4;
+    constexpr int items_per_producer = 500;
+
+    hinder::rendezvous_queue<int> que;
+    std::atomic<long long>        sent {0};
+    std::atomic<long long>        received {0};
+
+    std::vector<std::thread> consumers;
+    consumers.reserve(num_consumers);
+    for (int idx = 0; idx < num_consumers; ++idx) {
+        consumers.emplace_back([&] {
+            while (const auto val = que.pop()) {
+                received.fetch_add(*val, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    producers.reserve(num_producers);
+    for (int idx = 0; idx < num_producers; ++idx) {
+        producers.emplace_back([&] {
+            for (int jdx = 1; jdx <= items_per_producer; ++jdx) {
+                EXPECT_TRUE(que.push(jdx));
+                sent.fetch_add(jdx, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (auto& thd : producers) {
+        thd.join();
+    }
+    que.close();
+    for (auto& thd : consumers) {
+        thd.join();
+    }
+
+    EXPECT_EQ(received.load(), sent.load());
+}
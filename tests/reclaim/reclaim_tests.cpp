@@ -0,0 +1,249 @@
+//
+// hinder::reclaim
+//
+// MIT License
+//
+// Copyright (c) 2026  Tony Walker
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <hinder/reclaim/epoch.h>
+#include <hinder/reclaim/hazard_pointer.h>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+    // Counts live instances so tests can observe when the domain frees a node.
+    struct node {
+        static inline std::atomic<int> live {0};
+
+        explicit node(int val) : value(val) { live.fetch_add(1); }
+        ~node() { live.fetch_sub(1); }
+
+        node(node const &)                     = delete;
+        auto operator=(node const &) -> node & = delete;
+        node(node &&)                          = delete;
+        auto operator=(node &&) -> node &      = delete;
+
+        int                value;
+        std::atomic<node *> next {nullptr};
+    };
+
+    // Treiber stack parameterized on the reclamation domain.
+    template <typename Domain>
+    class stack {
+    public:
+        explicit stack(Domain & domain) : m_domain(domain) {}
+
+        ~stack() {
+            auto * top = m_head.load();
+            while (top != nullptr) {
+                delete std::exchange(top, top->next.load());
+            }
+        }
+
+        stack(stack const &)                     = delete;
+        auto operator=(stack const &) -> stack & = delete;
+        stack(stack &&)                          = delete;
+        auto operator=(stack &&) -> stack &      = delete;
+
+        auto push(int value) -> void {
+            auto * fresh = new node(value);
+            auto * top   = m_head.load();
+            do {
+                fresh->next.store(top);
+            } while (!m_head.compare_exchange_weak(top, fresh));
+        }
+
+        auto pop() -> std::optional<int> {
+            typename Domain::guard grd(m_domain);
+            auto *                 top = grd.protect(m_head);
+            while (top != nullptr && !m_head.compare_exchange_weak(top, top->next.load())) {
+                top = grd.protect(m_head);
+            }
+            if (top == nullptr) {
+                return std::nullopt;
+            }
+            auto const value = top->value;
+            grd.reset();
+            grd.retire(top);
+            return value;
+        }
+
+    private:
+        Domain &           m_domain;
+        std::atomic<node *> m_head {nullptr};
+    };
+
+    template <typename Domain>
+    class reclaim_test : public ::testing::Test {};
+
+    using domain_types = ::testing::Types<hinder::hazard_domain, hinder::epoch_domain>;
+    TYPED_TEST_SUITE(reclaim_test, domain_types);
+
+}  // namespace
+
+TYPED_TEST(reclaim_test, retired_nodes_are_freed_during_use) {
+    TypeParam domain(8);
+    for (int idx = 0; idx < 100; ++idx) {
+        typename TypeParam::guard grd(domain);
+        grd.retire(new node(idx));
+    }
+    EXPECT_LT(domain.pending(), 100U);
+    EXPECT_EQ(node::live.load(), static_cast<int>(domain.pending()));
+}
+
+TYPED_TEST(reclaim_test, destructor_frees_pending_nodes) {
+    {
+        TypeParam                 domain(1000);
+        typename TypeParam::guard grd(domain);
+        for (int idx = 0; idx < 10; ++idx) {
+            grd.retire(new node(idx));
+        }
+        EXPECT_EQ(domain.pending(), 10U);
+    }
+    EXPECT_EQ(node::live.load(), 0);
+}
+
+TYPED_TEST(reclaim_test, protect_returns_current_value) {
+    TypeParam          domain;
+    node               first(1);
+    std::atomic<node *> src {&first};
+
+    typename TypeParam::guard grd(domain);
+    EXPECT_EQ(grd.protect(src), &first);
+    src.store(nullptr);
+    EXPECT_EQ(grd.protect(src, 1), nullptr);
+}
+
+TYPED_TEST(reclaim_test, concurrent_stack_frees_every_node) {
+    constexpr int threads = 4;
+    constexpr int items   = 20000;
+    {
+        TypeParam            domain;
+        stack<TypeParam>     stk(domain);
+        std::atomic<long>    sum {0};
+        std::vector<std::thread> workers;
+        for (int thr = 0; thr < threads; ++thr) {
+            workers.emplace_back([&stk, &sum]() -> void {
+                for (int idx = 0; idx < items; ++idx) {
+                    stk.push(idx);
+                    if (auto value = stk.pop()) {
+                        sum.fetch_add(*value);
+                    }
+                }
+            });
+        }
+        for (auto & worker : workers) {
+            worker.join();
+        }
+        while (auto value = stk.pop()) {
+            sum.fetch_add(*value);
+        }
+        EXPECT_EQ(sum.load(), static_cast<long>(threads) * items * (items - 1) / 2);
+    }
+    EXPECT_EQ(node::live.load(), 0);
+}
+
+TEST(hazard_domain, protected_node_survives_retire) {
+    hinder::hazard_domain domain(4);
+    auto *                target = new node(42);
+    std::atomic<node *>    src {target};
+
+    hinder::hazard_domain::guard reader(domain);
+    ASSERT_EQ(reader.protect(src), target);
+    src.store(nullptr);
+
+    std::thread([&domain, target]() -> void {
+        hinder::hazard_domain::guard writer(domain);
+        writer.retire(target);
+        for (int idx = 0; idx < 100; ++idx) {
+            writer.retire(new node(idx));
+        }
+    }).join();
+    EXPECT_EQ(target->value, 42);
+
+    // Once the hazard is cleared, the next scan of that retire list frees it.
+    reader.reset();
+    {
+        hinder::hazard_domain::guard writer(domain);
+        for (int idx = 0; idx < 100; ++idx) {
+            writer.retire(new node(idx));
+        }
+    }
+    EXPECT_LT(domain.pending(), 100U);
+}
+
+TEST(hazard_domain, memory_is_bounded_with_stalled_reader) {
+    constexpr std::size_t threshold = 16;
+    hinder::hazard_domain domain(threshold);
+    node                  pinned(0);
+    std::atomic<node *>    src {&pinned};
+
+    hinder::hazard_domain::guard stalled(domain);
+    ASSERT_EQ(stalled.protect(src), &pinned);
+
+    hinder::hazard_domain::guard writer(domain);
+    for (int idx = 0; idx < 10000; ++idx) {
+        writer.retire(new node(idx));
+        ASSERT_LE(domain.pending(), threshold + 2 * hinder::hazard_domain::slots_per_guard);
+    }
+}
+
+TEST(hazard_domain, slot_out_of_range_throws) {
+    hinder::hazard_domain        domain;
+    std::atomic<node *>           src {nullptr};
+    hinder::hazard_domain::guard grd(domain);
+    EXPECT_THROW((void)grd.protect(src, hinder::hazard_domain::slots_per_guard),
+                 hinder::reclaim_error);
+    EXPECT_THROW(grd.reset(hinder::hazard_domain::slots_per_guard), hinder::reclaim_error);
+}
+
+TEST(epoch_domain, pinned_guard_blocks_reclamation) {
+    hinder::epoch_domain domain(4);
+    auto *               target = new node(42);
+
+    std::optional<hinder::epoch_domain::guard> reader;
+    reader.emplace(domain);
+
+    std::thread([&domain, target]() -> void {
+        hinder::epoch_domain::guard writer(domain);
+        writer.retire(target);
+        for (int idx = 0; idx < 100; ++idx) {
+            writer.retire(new node(idx));
+        }
+    }).join();
+    EXPECT_EQ(target->value, 42);
+    EXPECT_EQ(domain.pending(), 101U);
+
+    // Once the reader unpins, the epoch can advance and the backlog drains.
+    reader.reset();
+    for (int idx = 0; idx < 300; ++idx) {
+        hinder::epoch_domain::guard writer(domain);
+        writer.retire(new node(idx));
+    }
+    EXPECT_LT(domain.pending(), 101U);
+}